@@ -73,6 +73,12 @@ typedef struct
 	mach_msg_type_number_t * _Nullable new_stateCnt;
 } bad_instruction_exception_reply_t;
 
+// A function that handles the `catch_mach_exception_raise_state` callback directly. If set, it is used instead of relaying the reply through the Objective-C `BadInstructionException.receiveReply:` method.
+typedef kern_return_t (*bad_instruction_exception_handler_t)(bad_instruction_exception_reply_t *reply);
+
+// Sets (or, if NULL, clears) the function used to handle `catch_mach_exception_raise_state`. Should be set before any exception port is installed.
+void set_bad_instruction_exception_handler(bad_instruction_exception_handler_t _Nullable handler);
+
 NS_ASSUME_NONNULL_END
 
 #endif
@@ -48,7 +48,11 @@ public class BadInstructionException: NSException {
 	public class func receiveReply(_ value: NSValue) -> NSNumber {
 		var reply = bad_instruction_exception_reply_t(exception_port: 0, exception: 0, code: nil, codeCnt: 0, flavor: nil, old_state: nil, old_stateCnt: 0, new_state: nil, new_stateCnt: nil)
 		withUnsafeMutablePointer(to: &reply) { value.getValue(UnsafeMutableRawPointer($0)) }
-		
+		return NSNumber(value: handleReply(reply))
+	}
+	
+	/// Rewrites the thread state in `reply` so that the faulting thread resumes in `raiseBadInstructionException`. Invoked directly from `catch_mach_exception_raise_state` (when installed with `set_bad_instruction_exception_handler`) or via `receiveReply`.
+	static func handleReply(_ reply: bad_instruction_exception_reply_t) -> kern_return_t {
 		let old_state: UnsafePointer<natural_t> = reply.old_state!
 		let old_stateCnt: mach_msg_type_number_t = reply.old_stateCnt
 		let new_state: thread_state_t = reply.new_state!
@@ -56,7 +60,7 @@ public class BadInstructionException: NSException {
 		
 		// Make sure we've been given enough memory
 		if old_stateCnt != x86_THREAD_STATE64_COUNT || new_stateCnt.pointee < x86_THREAD_STATE64_COUNT {
-			return NSNumber(value: KERN_INVALID_ARGUMENT)
+			return KERN_INVALID_ARGUMENT
 		}
 		
 		// Read the old thread state
@@ -69,7 +73,7 @@ public class BadInstructionException: NSException {
 		if let pointer = UnsafeMutablePointer<__uint64_t>(bitPattern: UInt(state.__rsp)) {
 			pointer.pointee = state.__rip
 		} else {
-			return NSNumber(value: KERN_INVALID_ARGUMENT)
+			return KERN_INVALID_ARGUMENT
 		}
 		
 		// 3. Set the Instruction Pointer to the new function's address
@@ -82,7 +86,7 @@ public class BadInstructionException: NSException {
 		new_state.withMemoryRebound(to: x86_thread_state64_t.self, capacity: 1) { $0.pointee = state }
 		new_stateCnt.pointee = x86_THREAD_STATE64_COUNT
 		
-		return NSNumber(value: KERN_SUCCESS)
+		return KERN_SUCCESS
 	}
 }
 
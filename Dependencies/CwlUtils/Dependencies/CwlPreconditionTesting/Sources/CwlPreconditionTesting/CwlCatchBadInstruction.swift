@@ -68,6 +68,7 @@ private struct MachContext {
 	var flavors = execTypesCountTuple<thread_state_flavor_t>()
 	var currentExceptionPort: mach_port_t = 0
 	var handlerThread: pthread_t? = nil
+	var handlesRepeatedExceptions = false
 	
 	static func internalMutablePointers<R>(_ m: UnsafeMutablePointer<execTypesCountTuple<exception_mask_t>>, _ c: UnsafeMutablePointer<mach_msg_type_number_t>, _ p: UnsafeMutablePointer<execTypesCountTuple<mach_port_t>>, _ b: UnsafeMutablePointer<execTypesCountTuple<exception_behavior_t>>, _ f: UnsafeMutablePointer<execTypesCountTuple<thread_state_flavor_t>>, _ block: (UnsafeMutablePointer<exception_mask_t>, UnsafeMutablePointer<mach_msg_type_number_t>,  UnsafeMutablePointer<mach_port_t>, UnsafeMutablePointer<exception_behavior_t>, UnsafeMutablePointer<thread_state_flavor_t>) -> R) -> R {
 		return m.withMemoryRebound(to: exception_mask_t.self, capacity: 1) { masksPtr in
@@ -88,7 +89,12 @@ private struct MachContext {
 	}
 }
 
-/// A function for receiving mach messages and parsing the first with mach_exc_server (and if any others are received, throwing them away).
+/// Installs `BadInstructionException.handleReply` as the handler for `catch_mach_exception_raise_state`, so replies are built without relaying through Objective-C. Swift initializes globals lazily and exactly once, so referencing this value before creating a handler thread is sufficient.
+private let directReplyHandlerInstalled: Void = {
+	set_bad_instruction_exception_handler { reply in BadInstructionException.handleReply(reply.pointee) }
+}()
+
+/// A function for receiving mach messages and parsing the first with mach_exc_server (and if any others are received, throwing them away unless `handlesRepeatedExceptions` is set).
 private func machMessageHandler(_ arg: UnsafeMutableRawPointer) -> UnsafeMutableRawPointer? {
 	let context = arg.assumingMemoryBound(to: MachContext.self).pointee
 	var request = request_mach_exception_raise_t()
@@ -111,7 +117,7 @@ private func machMessageHandler(_ arg: UnsafeMutableRawPointer) -> UnsafeMutable
 		reply.Head.msgh_size = UInt32(MemoryLayout<reply_mach_exception_raise_state_t>.size)
 		reply.NDR = NDR_record
 		
-		if !handledfirstException {
+		if !handledfirstException || context.handlesRepeatedExceptions {
 			// Use the MiG generated server to invoke our handler for the request and fill in the rest of the reply structure
 			guard request.withMsgHeaderPointer(in: { requestPtr in reply.withMsgHeaderPointer { replyPtr in
 				mach_exc_server(requestPtr, replyPtr)
@@ -153,6 +159,12 @@ public func catchBadInstruction(in block: @escaping () -> Void) -> BadInstructio
 		_swift_disableExclusivityChecking = previousExclusivity
 	}
 	
+	// Between `BadInstructionCatcher.begin()` and `end()`, use the session's port and handler thread
+	if let session = BadInstructionCatcher.current {
+		return session.run(block)
+	}
+	_ = directReplyHandlerInstalled
+	
 	var context = MachContext()
 	var result: BadInstructionException? = nil
 	do {
@@ -205,6 +217,107 @@ public func catchBadInstruction(in block: @escaping () -> Void) -> BadInstructio
 
 	return result
 }
+
+/// A long-lived mach exception port and handler thread, shared by calls to `catchBadInstruction(in:)`.
+///
+/// Each call to `catchBadInstruction(in:)` normally allocates a mach port and creates a thread to handle messages on it. Between a call to `BadInstructionCatcher.begin()` and the balancing `BadInstructionCatcher.end()`, calls instead share one port and one handler thread, so a call costs little more than swapping the calling thread's exception port. This is intended for test suites that check many preconditions (call `begin` in `setUp` or `class func setUp` and `end` in the corresponding `tearDown`).
+///
+/// Calls to `begin` and `end` may be nested and may occur on any thread. The port and thread are released when the outermost `begin` is balanced and any `catchBadInstruction(in:)` still using the session has returned.
+public final class BadInstructionCatcher {
+	private static let lock = NSLock()
+	private static var session: BadInstructionCatcher? = nil
+	private static var depth = 0
+	
+	// Heap allocated since the handler thread reads it after `init` returns
+	private let context: UnsafeMutablePointer<MachContext>
+	private var handlerThread: pthread_t? = nil
+	
+	/// Starts the shared session or, if it is already started, extends it until a further call to `end`.
+	public static func begin() {
+		lock.lock()
+		defer { lock.unlock() }
+		if depth == 0 {
+			session = BadInstructionCatcher()
+		}
+		depth += 1
+	}
+	
+	/// Balances a previous call to `begin`.
+	public static func end() {
+		lock.lock()
+		precondition(depth > 0, "BadInstructionCatcher.end() called without a matching begin()")
+		depth -= 1
+		let finished = depth == 0 ? session : nil
+		if depth == 0 {
+			session = nil
+		}
+		lock.unlock()
+		
+		// Release outside the lock since `deinit` waits for the handler thread
+		withExtendedLifetime(finished) {}
+	}
+	
+	// The active session, if any
+	fileprivate static var current: BadInstructionCatcher? {
+		lock.lock()
+		defer { lock.unlock() }
+		return session
+	}
+	
+	private init() {
+		_ = directReplyHandlerInstalled
+		context = UnsafeMutablePointer<MachContext>.allocate(capacity: 1)
+		context.initialize(to: MachContext())
+		context.pointee.handlesRepeatedExceptions = true
+		
+		let c = context
+		do {
+			try kernCheck {
+				mach_port_allocate(mach_task_self_, MACH_PORT_RIGHT_RECEIVE, &c.pointee.currentExceptionPort)
+			}
+			try kernCheck {
+				mach_port_insert_right(mach_task_self_, c.pointee.currentExceptionPort, c.pointee.currentExceptionPort, MACH_MSG_TYPE_MAKE_SEND)
+			}
+			let e = pthread_create(&handlerThread, nil, machMessageHandler, c)
+			guard e == 0 else { throw PthreadError.code(e) }
+		} catch {
+			// Should never be reached but this is testing code, don't try to recover, just abort
+			fatalError("Mach port error: \(error)")
+		}
+	}
+	
+	deinit {
+		// Destroying the port ends the handler thread's receive loop. As in `catchBadInstruction(in:)`, this must happen before `pthread_join`.
+		mach_port_destroy(mach_task_self_, context.pointee.currentExceptionPort)
+		if let t = handlerThread {
+			pthread_join(t, nil)
+		}
+		context.deinitialize(count: 1)
+		context.deallocate()
+	}
+	
+	// Applies the session's port as the calling thread's handler for the duration of `block`.
+	fileprivate func run(_ block: @escaping () -> Void) -> BadInstructionException? {
+		var saved = MachContext()
+		let port = context.pointee.currentExceptionPort
+		let thread = mach_thread_self()
+		defer { mach_port_deallocate(mach_task_self_, thread) }
+		
+		do {
+			try kernCheck { saved.withUnsafeMutablePointers { masksPtr, countPtr, portsPtr, behaviorsPtr, flavorsPtr in
+				thread_swap_exception_ports(thread, EXC_MASK_BAD_INSTRUCTION, port, Int32(bitPattern: UInt32(EXCEPTION_STATE) | MACH_EXCEPTION_CODES), x86_THREAD_STATE64, masksPtr, countPtr, portsPtr, behaviorsPtr, flavorsPtr)
+			} }
+		} catch {
+			// Should never be reached but this is testing code, don't try to recover, just abort
+			fatalError("Mach port error: \(error)")
+		}
+		defer { saved.withUnsafeMutablePointers { masksPtr, countPtr, portsPtr, behaviorsPtr, flavorsPtr in
+			_ = thread_swap_exception_ports(thread, EXC_MASK_BAD_INSTRUCTION, 0, EXCEPTION_DEFAULT, THREAD_STATE_NONE, masksPtr, countPtr, portsPtr, behaviorsPtr, flavorsPtr)
+		} }
+		
+		return BadInstructionException.catchException(in: block)
+	}
+}
 	
 #endif
 
@@ -64,4 +64,30 @@ class CatchBadInstructionTests: XCTestCase {
 		XCTAssert(exception2 == nil)
 	#endif
 	}
+	
+	func testBadInstructionCatcher() {
+	#if arch(x86_64) && !USE_POSIX_SIGNALS
+		BadInstructionCatcher.begin()
+		BadInstructionCatcher.begin()
+		
+		// Repeated catches (with and without an assertion failure) share the session's port and thread
+		var reached = 0
+		for i in 0..<100 {
+			let exception: BadInstructionException? = catchBadInstruction {
+				reached += 1
+				precondition(i % 2 == 1, "THIS PRECONDITION FAILURE IS EXPECTED")
+			}
+			XCTAssert((exception != nil) == (i % 2 == 0))
+		}
+		XCTAssert(reached == 100)
+		
+		// A nested `end` leaves the session running
+		BadInstructionCatcher.end()
+		XCTAssert(catchBadInstruction { precondition(false, "THIS PRECONDITION FAILURE IS EXPECTED") } != nil)
+		BadInstructionCatcher.end()
+		
+		// After the session ends, catching falls back to a per-call port and thread
+		XCTAssert(catchBadInstruction { precondition(false, "THIS PRECONDITION FAILURE IS EXPECTED") } != nil)
+	#endif
+	}
 }
@@ -27,6 +27,22 @@ public struct AddressInfo {
 	/// Address for which this struct was constructed
 	public let address: UInt
 	
+	// Previously constructed instances, keyed by address. Symbolicating the same code addresses repeatedly (as diagnostics generally do) then requires only a single `dladdr` per address.
+	private static let cacheMutex = PThreadMutex()
+	private static var cache: [UInt: AddressInfo] = [:]
+	
+	/// Returns a previously constructed instance for the address, or constructs (and caches) a new instance.
+	/// - parameter address: the instruction address
+	/// - returns: the `AddressInfo` for `address`
+	public static func cached(address: UInt) -> AddressInfo {
+		if let existing = cacheMutex.sync(execute: { cache[address] }) {
+			return existing
+		}
+		let info = AddressInfo(address: address)
+		cacheMutex.sync { cache[address] = info }
+		return info
+	}
+	
 	/// Construct for an address
 	public init(address: UInt) {
 		self.address = address
@@ -80,11 +96,11 @@ public struct AddressInfo {
 	}
 }
 
-/// When applied to the output of callStackReturnAddresses, produces identical output to the execinfo function "backtrace_symbols" or NSThread.callStackSymbols
+/// When applied to the output of callStackReturnAddresses, produces identical output to the execinfo function "backtrace_symbols" or NSThread.callStackSymbols. Address lookups are cached (see `AddressInfo.cached(address:)`).
 /// - parameter addresses: an array of memory addresses, generally as produced by `callStackReturnAddresses`
 /// - returns: an array of formatted, symbolicated stack frame descriptions.
 public func symbolsForCallStack(addresses: [UInt]) -> [String] {
 	return Array(addresses.enumerated().map { tuple -> String in
-		return AddressInfo(address: tuple.element).formattedDescription(index: tuple.offset)
+		return AddressInfo.cached(address: tuple.element).formattedDescription(index: tuple.offset)
 	})
 }
@@ -60,6 +60,10 @@ public protocol CustomExecutionContext {
 	/// Gets a timestamp representing the host uptime the in the current context
 	/// NOTE: a default implementation of this function is provided that calls `DispatchTime.now()`. With the exception of debug, test and other host-isolated contexts, this is usually sufficient. 
 	func timestamp() -> DispatchTime
+	
+	/// Whether this context runs on host time (`DispatchTime`), so its timers can be multiplexed onto a `TimerWheel` (which calls `invoke` when a timer fires) rather than each needing its own `singleTimer`. Used by `Exec.reschedulableTimer`.
+	/// NOTE: a default implementation of this is provided that returns `false`. Contexts with their own notion of time (like `DebugContext`) must keep the default.
+	var usesDispatchTimers: Bool { get }
 }
 
 /// Many of the ExecutionContext functions returns a `Lifetime` and in most cases, that lifetime is just a dispatch timer. Annoyingly, a `DispatchSourceTimer` is an existential, so we can't extend it to conform to `Lifetime` (a limitation of Swift 4).
@@ -98,6 +102,10 @@ public extension CustomExecutionContext {
 		return DispatchTime.now()
 	}
 	
+	var usesDispatchTimers: Bool {
+		return false
+	}
+	
 	func invokeAsync(_ execute: @escaping () -> Void) {
 		if type.isImmediateInCurrentContext == false {
 			invoke(execute)
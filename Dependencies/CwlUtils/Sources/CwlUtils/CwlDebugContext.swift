@@ -60,10 +60,12 @@ public func ==(left: DebugContextThread, right: DebugContextThread) -> Bool {
 
 /// Simulates running a series of blocks across threads over time by instead queuing the blocks and running them serially in time priority order, incrementing the `currentTime` to reflect the time priority of the last run block.
 /// The result is a deterministic simulation of time scheduled blocks, which is otherwise subject to thread scheduling non-determinism.
+///
+/// Blocks scheduled for the same time run in the order they were scheduled, regardless of thread. Scheduling, cancelling and running each block is O(log n) in the number of pending blocks.
 public class DebugContextCoordinator {
 	// We use DispatchTime for time calculations but time 0 is treated as a special value ("now") so we start at time = 1, internally, and subtract 1 when returning through the public `currentTime` accessor.
 	var internalTime: UInt64 = 1
-	var queues: Dictionary<DebugContextThread, DebugContextQueue> = [:]
+	var pending = DebugContextSchedule()
 	var stopRequested: Bool = false
 	
 	/// Returns the current simulated time in nanoseconds
@@ -126,9 +128,9 @@ public class DebugContextCoordinator {
 			}
 		}
 		if stopRequested {
-			// Since releasing `queues` will likely cause the release of closures and items held by the queue, which might lead to nested calls to remove items from `queues` violating ownership rules...
-			// We copy queues to a non-shared stack location, clear `queues` and *then* release the contents.
-			withExtendedLifetime(queues) { queues = [:] }
+			// Since releasing `pending` will likely cause the release of closures and items held by the blocks, which might lead to nested calls to remove items from `pending` violating ownership rules...
+			// We copy pending to a non-shared stack location, clear `pending` and *then* release the contents.
+			withExtendedLifetime(pending) { pending = DebugContextSchedule() }
 		}
 	}
 	
@@ -138,13 +140,13 @@ public class DebugContextCoordinator {
 	public func runScheduledTasks(untilTime: UInt64) {
 		stopRequested = false
 		currentThread = .unspecified
-		while !stopRequested, let (threadIndex, time) = nextTask(), time <= untilTime {
-			_ = runTask(threadIndex: threadIndex, time: time)
+		while !stopRequested, let next = pending.first, next.time <= untilTime {
+			_ = runNextTask()
 		}
 		if stopRequested {
-			// Since releasing `queues` will likely cause the release of closures and items held by the queue, which might lead to nested calls to remove items from `queues` violating ownership rules...
-			// We copy queues to a non-shared stack location, clear `queues` and *then* release the contents.
-			withExtendedLifetime(queues) { queues = [:] }
+			// Since releasing `pending` will likely cause the release of closures and items held by the blocks, which might lead to nested calls to remove items from `pending` violating ownership rules...
+			// We copy pending to a non-shared stack location, clear `pending` and *then* release the contents.
+			withExtendedLifetime(pending) { pending = DebugContextSchedule() }
 		}
 	}
 	
@@ -157,134 +159,137 @@ public class DebugContextCoordinator {
 	public func reset() {
 		internalTime = 1
 		
-		// Since releasing `queues` will likely cause the release of closures and items held by the queue, which might lead to nested calls to remove items from `queues` violating ownership rules...
-		// We copy queues to a non-shared stack location, clear `queues` and *then* release the contents.
-		withExtendedLifetime(queues) { queues = [:] }
-	}
-	
-	func getOrCreateQueue(forName: DebugContextThread) -> DebugContextQueue {
-		if let t = queues[forName] {
-			return t
-		}
-		let t = DebugContextQueue()
-		
-		// Since releasing `queues` will likely cause the release of closures and items held by the queue, which might lead to nested calls to remove items from `queues` violating ownership rules...
-		// We copy queues to a non-shared stack location, clear `queues` and *then* release the contents.
-		withExtendedLifetime(queues[forName]) { queues[forName] = t }
-		
-		return t
+		// Since releasing `pending` will likely cause the release of closures and items held by the blocks, which might lead to nested calls to remove items from `pending` violating ownership rules...
+		// We copy pending to a non-shared stack location, clear `pending` and *then* release the contents.
+		withExtendedLifetime(pending) { pending = DebugContextSchedule() }
 	}
 	
 	// Fundamental method for scheduling a block on the coordinator for later invocation.
 	func schedule(block: @escaping () -> Void, thread: DebugContextThread, timeInterval interval: Int64, repeats: Bool) -> DebugContextTimer {
 		let i = interval > 0 ? UInt64(interval) : 0 as UInt64
 		let debugContextTimer = DebugContextTimer(thread: thread, rescheduleInterval: repeats ? i : nil, coordinator: self)
-		getOrCreateQueue(forName: thread).schedule(pending: PendingBlock(time: internalTime + i, timer: debugContextTimer, block: block))
+		pending.insert(time: internalTime + i, thread: thread, timer: debugContextTimer, block: block)
 		return debugContextTimer
 	}
 	
 	// Remove a block from the scheduler
 	func cancelTimer(_ toCancel: DebugContextTimer) {
-		if let t = queues[toCancel.thread]  {
-			t.cancelTimer(toCancel)
-		}
+		// The removed block is discarded after `pending` is no longer being mutated, since its release might cancel other timers
+		_ = pending.cancel(toCancel)
 	}
 	
-	func nextTask() -> (DebugContextThread, UInt64)? {
-		var lowestTime = UInt64.max
-		var selectedIndex = DebugContextThread.unspecified
-		
-		// We want a deterministic ordering, so we'll iterate over the queues by key sorted by hashValue
-		for index in queues.keys.sorted(by: { (left, right) -> Bool in left.hashValue < right.hashValue }) {
-			if let t = queues[index], t.nextTime < lowestTime {
-				selectedIndex = index
-				lowestTime = t.nextTime
-			}
-		}
-		if lowestTime == UInt64.max {
-			return nil
-		}
-		
-		return (selectedIndex, lowestTime)
-	}
-	
-	func runTask(threadIndex: DebugContextThread, time: UInt64) -> DebugContextTimer? {
-		(currentThread, internalTime) = (threadIndex, time)
-		return queues[threadIndex]?.popAndInvokeNext()
-	}
-	
-	// Run the next event. If nil is returned, no further events remain. If
+	// Run the next event. If nil is returned, no further events remain.
 	func runNextTask() -> DebugContextTimer? {
-		if let (threadIndex, time) = nextTask() {
-			return runTask(threadIndex: threadIndex, time: time)
+		guard let next = pending.popFirst() else { return nil }
+		(currentThread, internalTime) = (next.thread, next.time)
+		next.block()
+		if let nextTime = next.nextTime {
+			pending.insert(time: nextTime, thread: next.thread, timer: next.timer, block: next.block)
 		}
-		return nil
+		
+		// We ran a block, don't return nil (next.timer may return nil if it has self-cancelled)
+		return next.timer ?? DebugContextTimer()
 	}
 }
 
 // This structure is used to represent scheduled actions in the DebugContextCoordinator.
 struct PendingBlock {
 	let time: UInt64
+	let sequence: UInt64
+	let thread: DebugContextThread
 	weak var timer: DebugContextTimer?
 	let block: () -> Void
 	
-	init(time: UInt64, timer: DebugContextTimer?, block: @escaping () -> Void) {
+	init(time: UInt64, sequence: UInt64, thread: DebugContextThread, timer: DebugContextTimer?, block: @escaping () -> Void) {
 		self.time = time
+		self.sequence = sequence
+		self.thread = thread
 		self.timer = timer
 		self.block = block
 	}
 	
-	var nextInterval: PendingBlock? {
+	// Blocks are ordered by time and then by the order in which they were scheduled. Since `sequence` is unique, this is a total order.
+	func precedes(_ other: PendingBlock) -> Bool {
+		return time < other.time || (time == other.time && sequence < other.sequence)
+	}
+	
+	// The time at which a periodic block is next due, or nil if it should not be rescheduled
+	var nextTime: UInt64? {
 		if let t = timer, let i = t.rescheduleInterval, t.coordinator != nil {
-			return PendingBlock(time: time + i, timer: t, block: block)
+			return time + i
 		}
 		return nil
 	}
 }
 
-// A `DebugContextQueue` is just an array of `PendingBlock`, sorted by scheduled time. It represents the blocks queued for execution on a thread in the `DebugContextCoordinator`.
-class DebugContextQueue {
-	var pendingBlocks: Array<PendingBlock> = []
+// A `DebugContextSchedule` is a binary min-heap of `PendingBlock`, representing all blocks queued for execution on any thread in the `DebugContextCoordinator`. Each `DebugContextTimer` records the index of its pending block so that it can be cancelled without a search.
+struct DebugContextSchedule {
+	private var heap: Array<PendingBlock> = []
+	private var nextSequence: UInt64 = 0
 	
-	init() {
+	// The earliest scheduled block
+	var first: PendingBlock? {
+		return heap.first
 	}
 	
 	// Insert a block in scheduled order
-	func schedule(pending: PendingBlock) {
-		var insertionIndex = 0
-		while pendingBlocks.count > insertionIndex && pendingBlocks[insertionIndex].time <= pending.time {
-			insertionIndex += 1
-		}
-		
-		pendingBlocks.insert(pending, at: insertionIndex)
+	mutating func insert(time: UInt64, thread: DebugContextThread, timer: DebugContextTimer?, block: @escaping () -> Void) {
+		heap.append(PendingBlock(time: time, sequence: nextSequence, thread: thread, timer: timer, block: block))
+		nextSequence += 1
+		timer?.scheduleIndex = heap.count - 1
+		siftUp(heap.count - 1)
 	}
 	
-	// Remove a block
-	func cancelTimer(_ toCancel: DebugContextTimer) {
-		if let index = pendingBlocks.firstIndex(where: { tuple -> Bool in tuple.timer === toCancel }) {
-			pendingBlocks.remove(at: index)
+	// Remove and return the earliest scheduled block
+	mutating func popFirst() -> PendingBlock? {
+		return heap.isEmpty ? nil : remove(at: 0)
+	}
+	
+	// Remove and return the block for a timer. A timer that is released without being cancelled can no longer be matched through the block's weak reference so, as for any other released timer, its block is left to run.
+	mutating func cancel(_ timer: DebugContextTimer) -> PendingBlock? {
+		guard let index = timer.scheduleIndex, index < heap.count, heap[index].timer === timer else { return nil }
+		return remove(at: index)
+	}
+	
+	private mutating func remove(at index: Int) -> PendingBlock {
+		exchange(index, heap.count - 1)
+		let removed = heap.removeLast()
+		removed.timer?.scheduleIndex = nil
+		if index < heap.count {
+			siftDown(index)
+			siftUp(index)
 		}
+		return removed
 	}
 	
-	// Return the earliest scheduled time in the queue
-	var nextTime: UInt64 {
-		return pendingBlocks.first?.time ?? UInt64.max
+	private mutating func exchange(_ a: Int, _ b: Int) {
+		guard a != b else { return }
+		heap.swapAt(a, b)
+		heap[a].timer?.scheduleIndex = a
+		heap[b].timer?.scheduleIndex = b
 	}
 	
-	// Runs the next block in the queue
-	func popAndInvokeNext() -> DebugContextTimer? {
-		if let next = pendingBlocks.first {
-			pendingBlocks.remove(at: 0)
-			next.block()
-			if let nextInterval = next.nextInterval {
-				schedule(pending: nextInterval)
-			}
-			
-			// We ran a block, don't return nil (next.timer may return nil if it has self-cancelled)
-			return next.timer ?? DebugContextTimer()
+	private mutating func siftUp(_ index: Int) {
+		var child = index
+		while child > 0 {
+			let parent = (child - 1) / 2
+			guard heap[child].precedes(heap[parent]) else { return }
+			exchange(child, parent)
+			child = parent
+		}
+	}
+	
+	private mutating func siftDown(_ index: Int) {
+		var parent = index
+		while true {
+			let left = 2 * parent + 1
+			guard left < heap.count else { return }
+			let right = left + 1
+			let child = right < heap.count && heap[right].precedes(heap[left]) ? right : left
+			guard heap[child].precedes(heap[parent]) else { return }
+			exchange(parent, child)
+			parent = child
 		}
-		
-		return nil
 	}
 }
 
@@ -405,6 +410,9 @@ class DebugContextTimer: Lifetime {
 	let rescheduleInterval: UInt64?
 	weak var coordinator: DebugContextCoordinator?
 	
+	// The index of this timer's pending block in the coordinator's `DebugContextSchedule` (nil when not scheduled)
+	var scheduleIndex: Int? = nil
+	
 	init() {
 		thread = .unspecified
 		coordinator = nil
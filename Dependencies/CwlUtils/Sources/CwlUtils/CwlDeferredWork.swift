@@ -31,81 +31,170 @@ import Foundation
 //  1. If the deferred work calls back into the mutex, it must be able to ensure that it is still relevant (hasn't been superceded by an action that may have occurred between the end of the mutex and the performing of the `DeferredWork`. This may involve a token (inside the mutex, only the most recent token is accepted) or the mutex queueing further requests until the most recent `DeferredWork` completes.
 //  2. The `runWork` must be manually invoked. Automtic invocation (e.g in the `deinit` of a lifetime managed `class` instance) would add heap allocation overhead and would also be easy to accidentally release at the wrong point (inside the mutex) causing erratic problems. Instead, the `runWork` is guarded with a `DEBUG`-only `OnDelete` check that ensures that the `runWork` has been correctly invoked by the time the `DeferredWork` falls out of scope.
 public struct DeferredWork {
-	typealias PossibleWork = Few<() -> Void>
+	public typealias Work = () -> Void
 	
-	var work: PossibleWork
-
-	#if DEBUG
+	// The first four blocks of work are stored inline so that typical usage (activation, deactivation, resume) performs no heap allocation.
+	var w0: Work? = nil
+	var w1: Work? = nil
+	var w2: Work? = nil
+	var w3: Work? = nil
+	var count: Int = 0
+	
+	// Any further work is stored in a spill buffer, borrowed from a per-thread cache on first use and returned to the cache (emptied but retaining its capacity) by `runWork`.
+	var spill: Array<Work>? = nil
+	
+	// Define `DEFERRED_WORK_NO_CHECK` to omit the check (and its per-instance allocation and call stack capture) from `DEBUG` builds, e.g. when profiling. Release builds never include it.
+	#if DEBUG && !DEFERRED_WORK_NO_CHECK
 		let invokeCheck: OnDelete = { () -> OnDelete in
-			var sourceStack = Thread.callStackReturnAddresses
+			let sourceStack = DeferredWork.sampleCallStack()
 			return OnDelete {
-				let symbols = symbolsForCallStack(addresses: sourceStack.map { $0.uintValue })
+				guard let stack = sourceStack else {
+					preconditionFailure("Failed to perform work deferred at an unsampled location (set DeferredWork.callStackSamplingInterval to 1 to capture every location)")
+				}
+				let symbols = symbolsForCallStack(addresses: stack)
 				preconditionFailure("Failed to perform work deferred at location:\n" + symbols.joined(separator: "\n"))
 			}
 		}()
 	#endif
+	
+	/// In `DEBUG` builds, the maximum number of return addresses captured for the "work not performed" diagnostic.
+	///
+	/// This is read without synchronization by every thread that creates a `DeferredWork`, so it must be set before any `DeferredWork` is used on another thread (e.g. at launch, before any `Signal` graph is built).
+	public static var callStackDepth: Int = 16
+	
+	/// In `DEBUG` builds, one `DeferredWork` in every `callStackSamplingInterval` (counted per thread) captures its call stack for the "work not performed" diagnostic. Unsampled instances are still checked but report no location. A value of 1 captures every instance; 0 captures none.
+	///
+	/// As with `callStackDepth`, this must be set before any `DeferredWork` is used on another thread.
+	public static var callStackSamplingInterval: Int = 64
 
 	public init() {
-		work = .none
 	}
 	
 	public init(initial: @escaping () -> Void) {
-		work = .single(initial)
+		w0 = initial
+		count = 1
 	}
 	
 	public mutating func append(_ other: DeferredWork) {
-		#if DEBUG
+		#if DEBUG && !DEFERRED_WORK_NO_CHECK
 			precondition(invokeCheck.isValid && other.invokeCheck.isValid, "Work appended to an already cancelled/invoked DeferredWork")
 				other.invokeCheck.invalidate()
 		#endif
 		
-		switch other.work {
-		case .none: break
-		case .single(let otherWork): self.append(otherWork)
-		case .array(let otherWork):
-			switch work {
-			case .none: work = .array(otherWork)
-			case .single(let existing):
-				var newWork: Array<() -> Void> = [existing]
-				newWork.append(contentsOf: otherWork)
-				work = .array(newWork)
-			case .array(var existing):
-				work = .none
-				existing.append(contentsOf: otherWork)
-				work = .array(existing)
+		if let w = other.w0 { appendUnchecked(w) }
+		if let w = other.w1 { appendUnchecked(w) }
+		if let w = other.w2 { appendUnchecked(w) }
+		if let w = other.w3 { appendUnchecked(w) }
+		if let s = other.spill {
+			for w in s {
+				appendUnchecked(w)
 			}
 		}
 	}
 	
 	public mutating func append(_ additionalWork: @escaping () -> Void) {
-		#if DEBUG
+		#if DEBUG && !DEFERRED_WORK_NO_CHECK
 			precondition(invokeCheck.isValid, "Work appended to an already cancelled/invoked DeferredWork")
 		#endif
 		
-		switch work {
-		case .none: work = .single(additionalWork)
-		case .single(let existing): work = .array([existing, additionalWork])
-		case .array(var existing):
-			work = .none
-			existing.append(additionalWork)
-			work = .array(existing)
+		appendUnchecked(additionalWork)
+	}
+	
+	private mutating func appendUnchecked(_ additionalWork: @escaping () -> Void) {
+		switch count {
+		case 0: w0 = additionalWork
+		case 1: w1 = additionalWork
+		case 2: w2 = additionalWork
+		case 3: w3 = additionalWork
+		default:
+			if spill == nil {
+				spill = DeferredWork.borrowSpill()
+			}
+			spill?.append(additionalWork)
 		}
+		count += 1
 	}
 	
 	public mutating func runWork() {
-		#if DEBUG
+		#if DEBUG && !DEFERRED_WORK_NO_CHECK
 			precondition(invokeCheck.isValid, "Work run multiple times")
 			invokeCheck.invalidate()
 		#endif
 		
-		switch work {
-		case .none: break
-		case .single(let w): w()
-		case .array(let ws):
-			for w in ws {
+		guard count > 0 else { return }
+		
+		// Take ownership of the work so the storage in `self` is empty (and the spill buffer is uniquely referenced) while the work runs
+		let (a, b, c, d) = (w0, w1, w2, w3)
+		var s = spill
+		(w0, w1, w2, w3, spill, count) = (nil, nil, nil, nil, nil, 0)
+		
+		a?()
+		b?()
+		c?()
+		d?()
+		if s != nil {
+			for w in s! {
 				w()
 			}
+			s!.removeAll(keepingCapacity: true)
+			DeferredWork.returnSpill(s!)
+		}
+	}
+	
+	// If the current thread's sampling countdown has expired, walks the frame pointer chain to capture up to `callStackDepth` return addresses (skipping this function's own frame).
+	@inline(never)
+	static func sampleCallStack() -> [UInt]? {
+		let interval = callStackSamplingInterval
+		guard interval > 0, callStackDepth > 0 else { return nil }
+		let cache = DeferredWorkSpillCache.current
+		guard cache.samplingCountdown <= 1 else {
+			cache.samplingCountdown -= 1
+			return nil
+		}
+		cache.samplingCountdown = interval
+		return callStackReturnAddresses(skip: 1, maximumAddresses: callStackDepth)
+	}
+	
+	// Gets the spill buffer from the current thread's cache, if any, or a new, empty buffer.
+	private static func borrowSpill() -> Array<Work> {
+		let cache = DeferredWorkSpillCache.current
+		if let buffer = cache.buffer {
+			cache.buffer = nil
+			return buffer
+		}
+		return Array<Work>()
+	}
+	
+	// Stores an empty spill buffer in the current thread's cache, unless the cache already holds one.
+	private static func returnSpill(_ buffer: Array<Work>) {
+		let cache = DeferredWorkSpillCache.current
+		if cache.buffer == nil {
+			cache.buffer = buffer
+		}
+	}
+}
+
+// Holds the per-thread spill buffer and call stack sampling countdown used by `DeferredWork`. The cache is created on first use by each thread and released when the thread exits.
+private final class DeferredWorkSpillCache {
+	var buffer: Array<DeferredWork.Work>? = nil
+	var samplingCountdown: Int = 0
+	
+	static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		#if os(Linux)
+			pthread_key_create(&key) { Unmanaged<DeferredWorkSpillCache>.fromOpaque($0!).release() }
+		#else
+			pthread_key_create(&key) { Unmanaged<DeferredWorkSpillCache>.fromOpaque($0).release() }
+		#endif
+		return key
+	}()
+	
+	static var current: DeferredWorkSpillCache {
+		if let existing = pthread_getspecific(key) {
+			return Unmanaged<DeferredWorkSpillCache>.fromOpaque(existing).takeUnretainedValue()
 		}
-		work = .none
+		let cache = DeferredWorkSpillCache()
+		pthread_setspecific(key, Unmanaged.passRetained(cache).toOpaque())
+		return cache
 	}
 }
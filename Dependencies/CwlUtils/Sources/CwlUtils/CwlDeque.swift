@@ -87,6 +87,11 @@ public struct Deque<T>: RandomAccessCollection, MutableCollection, RangeReplacea
 			}
 		}
 		set {
+			guard isKnownUniquelyReferenced(&buffer) else {
+				precondition(at >= 0 && at < count)
+				replaceSubrange(at..<(at + 1), with: CollectionOfOne(newValue))
+				return
+			}
 			buffer!.withUnsafeMutablePointers { headerPtr, bodyPtr in
 				precondition(at >= 0 && at < headerPtr.pointee.count)
 				var offset = headerPtr.pointee.offset + at
@@ -120,7 +125,7 @@ public struct Deque<T>: RandomAccessCollection, MutableCollection, RangeReplacea
 	
 	/// Optimized implementation of RangeReplaceableCollection function
 	public mutating func append(_ newElement: T) {
-		let done = buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
+		let done = isKnownUniquelyReferenced(&buffer) && buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
 			guard headerPtr.pointee.capacity >= headerPtr.pointee.count + 1 else { return false }
 			var index = headerPtr.pointee.offset + headerPtr.pointee.count
 			if index >= headerPtr.pointee.capacity {
@@ -141,7 +146,7 @@ public struct Deque<T>: RandomAccessCollection, MutableCollection, RangeReplacea
 	
 	/// Optimized implementation of RangeReplaceableCollection function
 	public mutating func insert(_ newElement: T, at: Int) {
-		let done = buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
+		let done = isKnownUniquelyReferenced(&buffer) && buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
 			guard at == 0, headerPtr.pointee.capacity >= headerPtr.pointee.count + 1 else { return false }
 			var index = headerPtr.pointee.offset - 1
 			if index < 0 {
@@ -162,11 +167,17 @@ public struct Deque<T>: RandomAccessCollection, MutableCollection, RangeReplacea
 	
 	/// Optimized implementation of RangeReplaceableCollection function
 	public mutating func remove(at: Int) {
-		let done = buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
+		let done = isKnownUniquelyReferenced(&buffer) && buffer?.withUnsafeMutablePointers { headerPtr, bodyPtr -> Bool in
 			if at == headerPtr.pointee.count - 1 {
+				var index = headerPtr.pointee.offset + at
+				if index >= headerPtr.pointee.capacity {
+					index -= headerPtr.pointee.capacity
+				}
+				bodyPtr.advanced(by: index).deinitialize(count: 1)
 				headerPtr.pointee.count -= 1
 				return true
 			} else if at == 0, headerPtr.pointee.count > 0 {
+				bodyPtr.advanced(by: headerPtr.pointee.offset).deinitialize(count: 1)
 				headerPtr.pointee.offset += 1
 				if headerPtr.pointee.offset >= headerPtr.pointee.capacity {
 					headerPtr.pointee.offset -= headerPtr.pointee.capacity
@@ -185,7 +196,14 @@ public struct Deque<T>: RandomAccessCollection, MutableCollection, RangeReplacea
 	}
 	
 	/// Optimized implementation of RangeReplaceableCollection function
+	@discardableResult
 	public mutating func removeFirst() -> T {
+		guard isKnownUniquelyReferenced(&buffer) else {
+			precondition(count > 0, "Index beyond bounds")
+			let result = self[0]
+			replaceSubrange(0..<1, with: EmptyCollection())
+			return result
+		}
 		return buffer!.withUnsafeMutablePointers { headerPtr, bodyPtr -> T in
 			precondition(headerPtr.pointee.count > 0, "Index beyond bounds")
 			let result = bodyPtr[headerPtr.pointee.offset]
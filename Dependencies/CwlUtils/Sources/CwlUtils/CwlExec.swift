@@ -154,6 +154,14 @@ extension Exec: CustomExecutionContext {
 		}
 	}
 	
+	/// Whether this context runs on host time, so its timers can be multiplexed onto a `TimerWheel`. True for every case except `.custom` contexts that don't opt in.
+	public var usesDispatchTimers: Bool {
+		switch self {
+		case .custom(let c): return c.usesDispatchTimers
+		case .direct, .main, .queue: return true
+		}
+	}
+	
 	private var timerQueue: DispatchQueue {
 		switch self {
 		case .direct: return DispatchQueue.global()
@@ -0,0 +1,96 @@
+//
+//  CwlMainCoalescingContext.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+
+public extension Exec {
+	/// Invoked on the main thread, directly if the current thread is the main thread, otherwise asynchronously (unless invokeSync is used). Unlike `.main`, asynchronous invocations are not each queued as a separate `DispatchQueue.main` block: all invocations that arrive before the main thread next drains are run, in order, by a single block.
+	///
+	/// To also discard all but the latest value for a busy `Signal` handler, combine with `bounded(capacity: 1, policy: .coalesceLatest)`.
+	static var mainCoalesced: Exec {
+		return .custom(MainCoalescingContext.shared)
+	}
+}
+
+// The context behind `Exec.mainCoalesced`. Invocations from other threads are appended to `pending` and the first invocation after each drain schedules the next drain on the main queue.
+private final class MainCoalescingContext: CustomExecutionContext {
+	static let shared = MainCoalescingContext()
+	
+	private let mutex = PThreadMutex()
+	private var pending = Array<() -> Void>()
+	private var scheduled = false
+	
+	var type: ExecutionType {
+		return .thread { Thread.isMainThread }
+	}
+	
+	var usesDispatchTimers: Bool {
+		return true
+	}
+	
+	func invoke(_ execute: @escaping () -> Void) {
+		if Thread.isMainThread {
+			execute()
+		} else {
+			enqueue(execute)
+		}
+	}
+	
+	func invokeAsync(_ execute: @escaping () -> Void) {
+		enqueue(execute)
+	}
+	
+	func invokeSync<Return>(_ execute: () throws -> Return) rethrows -> Return {
+		if Thread.isMainThread {
+			return try execute()
+		}
+		return try DispatchQueue.main.sync(execute: execute)
+	}
+	
+	func relativeAsync(qos: DispatchQoS.QoSClass?) -> Exec {
+		return Exec.global(qos: qos ?? .userInteractive)
+	}
+	
+	private func enqueue(_ execute: @escaping () -> Void) {
+		mutex.unbalancedLock()
+		pending.append(execute)
+		let needsSchedule = !scheduled
+		scheduled = true
+		mutex.unbalancedUnlock()
+		
+		if needsSchedule {
+			DispatchQueue.main.async { self.drain() }
+		}
+	}
+	
+	// Runs everything pending when the drain starts. Invocations that arrive while the drain runs schedule a new drain, rather than extending this one, so other main queue work is not starved.
+	// The batch is moved into a local so that a drain started re-entrantly (e.g. by a block that runs a nested run loop) takes only the invocations queued since, and can never run a block from this batch a second time.
+	private func drain() {
+		mutex.unbalancedLock()
+		let batch = pending
+		pending = []
+		scheduled = false
+		mutex.unbalancedUnlock()
+		
+		for execute in batch {
+			execute()
+		}
+	}
+}
@@ -104,6 +104,36 @@ public final class PThreadMutex: RawMutex {
 	}
 }
 
+/// A basic wrapper around `pthread_cond_t`, used together with a `PThreadMutex` to block a thread until state protected by the mutex changes. This type is a "class" type to take advantage of the "deinit" method and prevent accidental copying of the `pthread_cond_t`.
+public final class PThreadCondition {
+	public var underlyingCondition = pthread_cond_t()
+	
+	public init() {
+		guard pthread_cond_init(&underlyingCondition, nil) == 0 else {
+			preconditionFailure()
+		}
+	}
+	
+	deinit {
+		pthread_cond_destroy(&underlyingCondition)
+	}
+	
+	/// Must be called with `mutex` locked. Atomically unlocks `mutex` and blocks until the condition is signalled, relocking `mutex` before returning. Wakeups may be spurious so callers should always wait in a loop that re-tests their predicate.
+	public func wait(mutex: PThreadMutex) {
+		pthread_cond_wait(&underlyingCondition, &mutex.underlyingMutex)
+	}
+	
+	/// Wakes at least one thread blocked in `wait(mutex:)`, if any.
+	public func signal() {
+		pthread_cond_signal(&underlyingCondition)
+	}
+	
+	/// Wakes all threads blocked in `wait(mutex:)`.
+	public func broadcast() {
+		pthread_cond_broadcast(&underlyingCondition)
+	}
+}
+
 /// A basic wrapper around `os_unfair_lock` (a non-FIFO, high performance lock that offers safety against priority inversion). This type is a "class" type to prevent accidental copying of the `os_unfair_lock`.
 @available(OSX 10.12, iOS 10, tvOS 10, watchOS 3, *)
 public final class UnfairLock: RawMutex {
@@ -127,3 +157,117 @@ public final class UnfairLock: RawMutex {
 		os_unfair_lock_unlock(&underlyingMutex)
 	}
 }
+
+/// A mutex that spins briefly with `trylock` before blocking. Short critical sections, contended across threads, are usually released before the spin completes, avoiding the cost of parking and waking a thread in the kernel.
+///
+/// Failed attempts back off exponentially (so spinning threads don't keep pulling the mutex's cache line away from its owner) and, once the pause reaches `maximumSpinPause`, yield the CPU with `sched_yield` in case the owner is waiting to run on it.
+///
+/// The primitive is `os_unfair_lock` on Darwin and a "NORMAL" `pthread_mutex_t` (which parks on a futex) on Linux. In both cases, a zero-initialized `MutexPrimitive()` is a valid, unlocked mutex that requires no destruction, so the static functions can be used on primitives stored inline in other types (as `Signal` does). This type is a "class" type to prevent accidental copying of the primitive.
+@available(OSX 10.12, iOS 10, tvOS 10, watchOS 3, *)
+public final class AdaptiveMutex: RawMutex {
+	#if os(Linux)
+		public typealias MutexPrimitive = pthread_mutex_t
+	#else
+		public typealias MutexPrimitive = os_unfair_lock
+	#endif
+	
+	/// The default number of `trylock` attempts before blocking. The first seven attempts are separated by pauses growing from 32 to 1024 nanoseconds (about 2 microseconds in total) and the remainder by yields.
+	public static let defaultSpinCount = 10
+	
+	/// The longest pause, in nanoseconds, between `trylock` attempts. Pauses start at 32 nanoseconds and double after each failed attempt. Beyond this limit, each attempt is preceded by `sched_yield` instead.
+	public static let maximumSpinPause: UInt64 = 1_024
+	
+	/// Exposed as an "unsafe" public property so non-scoped patterns can be implemented, if required.
+	public var underlyingMutex = MutexPrimitive()
+	
+	/// The number of `trylock` attempts made by `unbalancedLock` before blocking.
+	public let spinCount: Int
+	
+	/// Constructs an unlocked mutex.
+	///
+	/// - Parameter spinCount: number of `trylock` attempts made before blocking. A value of zero blocks immediately.
+	public init(spinCount: Int = AdaptiveMutex.defaultSpinCount) {
+		self.spinCount = spinCount
+	}
+	
+	public func unbalancedLock() {
+		AdaptiveMutex.lock(&underlyingMutex, spinCount: spinCount)
+	}
+	
+	public func unbalancedTryLock() -> Bool {
+		return AdaptiveMutex.tryLock(&underlyingMutex)
+	}
+	
+	public func unbalancedUnlock() {
+		AdaptiveMutex.unlock(&underlyingMutex)
+	}
+	
+	/// Acquires `primitive`, making up to `spinCount` `trylock` attempts before blocking.
+	///
+	/// - Returns: the number of `trylock` attempts that failed (equal to `spinCount` if the acquisition blocked)
+	@inline(__always) @discardableResult
+	public static func lock(_ primitive: inout MutexPrimitive, spinCount: Int) -> Int {
+		var failures = 0
+		var pause: UInt64 = 32
+		while failures < spinCount {
+			if tryLock(&primitive) {
+				return failures
+			}
+			failures += 1
+			if failures == spinCount {
+				break
+			} else if pause <= maximumSpinPause {
+				spinPause(nanoseconds: pause)
+				pause <<= 1
+			} else {
+				sched_yield()
+			}
+		}
+		#if os(Linux)
+			pthread_mutex_lock(&primitive)
+		#else
+			os_unfair_lock_lock(&primitive)
+		#endif
+		return failures
+	}
+	
+	// Busy-waits for `nanoseconds` without touching the mutex. Swift has no portable CPU "pause" instruction and an empty counting loop would be optimized away, so the pause is timed with the monotonic clock, which is read in userspace (commpage on Darwin, vDSO on Linux) rather than by a system call.
+	@inline(__always)
+	private static func spinPause(nanoseconds: UInt64) {
+		let start = monotonicNanoseconds()
+		while monotonicNanoseconds() &- start < nanoseconds {}
+	}
+	
+	@inline(__always)
+	private static func monotonicNanoseconds() -> UInt64 {
+		#if os(Linux)
+			var ts = timespec()
+			clock_gettime(CLOCK_MONOTONIC, &ts)
+			return UInt64(ts.tv_sec) &* 1_000_000_000 &+ UInt64(ts.tv_nsec)
+		#else
+			return clock_gettime_nsec_np(CLOCK_UPTIME_RAW)
+		#endif
+	}
+	
+	/// Acquires `primitive` if it is not already locked.
+	///
+	/// - Returns: true if the lock was acquired
+	@inline(__always)
+	public static func tryLock(_ primitive: inout MutexPrimitive) -> Bool {
+		#if os(Linux)
+			return pthread_mutex_trylock(&primitive) == 0
+		#else
+			return os_unfair_lock_trylock(&primitive)
+		#endif
+	}
+	
+	/// Releases `primitive`, which must have been acquired by the current thread.
+	@inline(__always)
+	public static func unlock(_ primitive: inout MutexPrimitive) {
+		#if os(Linux)
+			pthread_mutex_unlock(&primitive)
+		#else
+			os_unfair_lock_unlock(&primitive)
+		#endif
+	}
+}
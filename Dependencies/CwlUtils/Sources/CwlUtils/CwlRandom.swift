@@ -46,6 +46,9 @@ extension RandomGenerator {
 	}
 }
 
+/// Random bytes from the operating system's entropy source.
+///
+/// By default, every call to `next()` or `randomize(buffer:)` makes a `read` from "/dev/urandom". Using `init(bufferSize:)`, the generator instead refills a pool of `bufferSize` bytes in bulk (using `getentropy` where available) and serves requests from the pool, avoiding most of the syscall overhead when many small values are required. Copies of a pooled generator share its pool, so copying is cheap and a byte is never served to more than one copy. Access to the shared pool is serialized by a mutex, so copies may be used on different threads. A pool filled before a `fork` is discarded in the child.
 public struct DevRandom: RandomGenerator {
 	class FileDescriptor {
 		let value: CInt
@@ -58,14 +61,79 @@ public struct DevRandom: RandomGenerator {
 		}
 	}
 	
+	// Shared by copies of a pooled generator. `bytes` and `offset` are protected by `mutex`.
+	final class Pool {
+		let capacity: Int
+		let bytes: UnsafeMutableRawPointer
+		let mutex = PThreadMutex()
+		var offset: Int
+		let forkGeneration: Int
+		
+		init(capacity: Int) {
+			_ = devRandomForkHandlerRegistration
+			self.capacity = capacity
+			self.bytes = UnsafeMutableRawPointer.allocate(byteCount: capacity, alignment: MemoryLayout<UInt64>.alignment)
+			self.offset = capacity
+			self.forkGeneration = devRandomForkGeneration
+		}
+		
+		deinit {
+			memset(bytes, 0, capacity)
+			bytes.deallocate()
+		}
+	}
+	
+	/// Pools smaller than this are clamped to this size
+	public static let minimumBufferSize = 4096
+	
+	/// Pools larger than this are clamped to this size
+	public static let maximumBufferSize = 65536
+	
 	let fd: FileDescriptor
+	var pool: Pool?
+	
 	public init() {
 		fd = FileDescriptor()
+		pool = nil
+	}
+	
+	/// Constructs a pooled generator.
+	///
+	/// - Parameter bufferSize: size of the pool in bytes, clamped to `minimumBufferSize...maximumBufferSize`
+	public init(bufferSize: Int) {
+		fd = FileDescriptor()
+		pool = Pool(capacity: Swift.min(Swift.max(bufferSize, DevRandom.minimumBufferSize), DevRandom.maximumBufferSize))
 	}
 	
 	public mutating func randomize(buffer: UnsafeMutableRawBufferPointer) {
-		let result = read(fd.value, buffer.baseAddress, buffer.count)
-		precondition(result == buffer.count)
+		guard let base = buffer.baseAddress, buffer.count > 0 else { return }
+		guard let p = currentPool() else {
+			DevRandom.fill(base, count: buffer.count, fd: fd.value)
+			return
+		}
+		
+		// Requests as large as the pool gain nothing from the copy
+		if buffer.count >= p.capacity {
+			DevRandom.fill(base, count: buffer.count, fd: fd.value)
+			return
+		}
+		
+		p.mutex.unbalancedLock()
+		defer { p.mutex.unbalancedUnlock() }
+		var copied = 0
+		while copied < buffer.count {
+			if p.offset == p.capacity {
+				DevRandom.fill(p.bytes, count: p.capacity, fd: fd.value)
+				p.offset = 0
+			}
+			let count = Swift.min(p.capacity &- p.offset, buffer.count &- copied)
+			memcpy(base + copied, p.bytes + p.offset, count)
+			
+			// Served bytes are cleared so they can't be recovered from the pool later
+			memset(p.bytes + p.offset, 0, count)
+			p.offset = p.offset &+ count
+			copied = copied &+ count
+		}
 	}
 	
 	public mutating func next() -> UInt64 {
@@ -75,9 +143,55 @@ public struct DevRandom: RandomGenerator {
 		}
 		return bits
 	}
+	
+	// Returns the pool (if this is a pooled generator), replacing it first if it was filled before a `fork`. A pool from before the `fork` is abandoned without touching its `mutex`, which may have been held by another thread at the time of the `fork`.
+	private mutating func currentPool() -> Pool? {
+		guard let p = pool else { return nil }
+		if p.forkGeneration != devRandomForkGeneration {
+			let replacement = Pool(capacity: p.capacity)
+			pool = replacement
+			return replacement
+		}
+		return p
+	}
+	
+	// Fills the buffer from the operating system's entropy source.
+	// - Parameters:
+	//   - buffer: destination
+	//   - count: number of bytes
+	//   - fd: "/dev/urandom" file descriptor, used where `getentropy` is unavailable
+	private static func fill(_ buffer: UnsafeMutableRawPointer, count: Int, fd: CInt) {
+		#if !os(Linux)
+			if #available(OSX 10.12, iOS 10, tvOS 10, watchOS 3, *) {
+				// getentropy is limited to 256 bytes per call
+				var offset = 0
+				while offset < count {
+					let chunk = Swift.min(256, count &- offset)
+					let result = getentropy(buffer + offset, chunk)
+					precondition(result == 0)
+					offset = offset &+ chunk
+				}
+				return
+			}
+		#endif
+		var offset = 0
+		while offset < count {
+			let result = read(fd, buffer + offset, count &- offset)
+			precondition(result > 0)
+			offset = offset &+ result
+		}
+	}
 }
 
-public struct Xoshiro: RandomNumberGenerator {
+// Incremented in the child process after each `fork` so that pools filled by the parent are not reused
+private var devRandomForkGeneration = 0
+private let devRandomForkHandlerRegistration: Void = {
+	_ = pthread_atfork(nil, nil, {
+		devRandomForkGeneration = devRandomForkGeneration &+ 1
+	})
+}()
+
+public struct Xoshiro: RandomGenerator {
 	public typealias StateType = (UInt64, UInt64, UInt64, UInt64)
 
 	private var state: StateType = (0, 0, 0, 0)
@@ -91,6 +205,51 @@ public struct Xoshiro: RandomNumberGenerator {
 		self.state = seed
 	}
 	
+	/// Creates `count` generators from a single seed where each generator is positioned 2^128 words after the previous (using `jump()`), so the generators produce non-overlapping sequences. This allows reproducible parallel work with one generator per worker and no shared state.
+	///
+	/// - Parameters:
+	///   - count: number of generators
+	///   - seed: initial state of the first generator
+	/// - Returns: `count` generators, the first of which is identical to `Xoshiro(seed: seed)`
+	public static func streams(count: Int, seed: StateType) -> [Xoshiro] {
+		var result = [Xoshiro]()
+		result.reserveCapacity(count)
+		var generator = Xoshiro(seed: seed)
+		for _ in 0..<count {
+			result.append(generator)
+			generator.jump()
+		}
+		return result
+	}
+	
+	/// Advances the generator by the equivalent of 2^128 calls to `next()`. Successive jumps partition the full cycle into 2^128 non-overlapping subsequences for parallel computation.
+	public mutating func jump() {
+		jump(polynomial: (0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c))
+	}
+	
+	/// Advances the generator by the equivalent of 2^192 calls to `next()`. This can generate 2^64 starting points, from each of which `jump()` will generate 2^64 non-overlapping subsequences for distributed computation.
+	public mutating func longJump() {
+		jump(polynomial: (0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635))
+	}
+	
+	// Derived from the public domain jump functions for xoshiro256** by David Blackman and Sebastiano Vigna
+	// - Parameter polynomial: the jump polynomial (least significant word first)
+	private mutating func jump(polynomial: StateType) {
+		var result: StateType = (0, 0, 0, 0)
+		for word in [polynomial.0, polynomial.1, polynomial.2, polynomial.3] {
+			for b in 0 as UInt64..<64 {
+				if word & (1 << b) != 0 {
+					result.0 ^= state.0
+					result.1 ^= state.1
+					result.2 ^= state.2
+					result.3 ^= state.3
+				}
+				_ = next()
+			}
+		}
+		state = result
+	}
+	
 	public mutating func next() -> UInt64 {
 		// Derived from public domain implementation of xoshiro256** here:
 		// http://xoshiro.di.unimi.it
@@ -106,9 +265,32 @@ public struct Xoshiro: RandomNumberGenerator {
 		state.3 = (state.3 &<< 45) | (state.3 &>> 19)
 		return result
 	}
+	
+	/// Fills the buffer with the same sequence of words that repeated calls to `next()` would return (followed by the leading bytes of one further word if the buffer's size is not a multiple of 8).
+	public mutating func randomize(buffer: UnsafeMutableRawBufferPointer) {
+		guard let base = buffer.baseAddress else { return }
+		let wordSize = MemoryLayout<UInt64>.size
+		let wordCount = buffer.count / wordSize
+		if Int(bitPattern: base) % MemoryLayout<UInt64>.alignment == 0 {
+			for offset in 0..<wordCount {
+				base.storeBytes(of: next(), toByteOffset: offset &* wordSize, as: UInt64.self)
+			}
+		} else {
+			for offset in 0..<wordCount {
+				var word = next()
+				memcpy(base + offset &* wordSize, &word, wordSize)
+			}
+		}
+		
+		let remainder = buffer.count &- wordCount &* wordSize
+		if remainder > 0 {
+			var word = next()
+			memcpy(base + wordCount &* wordSize, &word, remainder)
+		}
+	}
 }
 
-public struct MersenneTwister: RandomNumberGenerator {
+public struct MersenneTwister: RandomGenerator {
 	// 312 words of storage is 13 x 6 x 4
 	private typealias StateType = (
 		UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64, UInt64,
@@ -191,39 +373,97 @@ public struct MersenneTwister: RandomNumberGenerator {
 	public mutating func next() -> UInt64 {
 		if index == MersenneTwister.stateCount {
 			withUnsafeMutablePointer(to: &state_internal) { $0.withMemoryRebound(to: UInt64.self, capacity: MersenneTwister.stateCount) { state in
-				let n = MersenneTwister.stateCount
-				let m = n / 2
-				let a: UInt64 = 0xB5026F5AA96619E9
-				let lowerMask: UInt64 = (1 << 31) - 1
-				let upperMask: UInt64 = ~lowerMask
-				var (i, j, stateM) = (0, m, state[m])
-				repeat {
-					let x1 = (state[i] & upperMask) | (state[i &+ 1] & lowerMask)
-					state[i] = state[i &+ m] ^ (x1 >> 1) ^ ((state[i &+ 1] & 1) &* a)
-					let x2 = (state[j] & upperMask) | (state[j &+ 1] & lowerMask)
-					state[j] = state[j &- m] ^ (x2 >> 1) ^ ((state[j &+ 1] & 1) &* a)
-					(i, j) = (i &+ 1, j &+ 1)
-				} while i != m &- 1
-				
-				let x3 = (state[m &- 1] & upperMask) | (stateM & lowerMask)
-				state[m &- 1] = state[n &- 1] ^ (x3 >> 1) ^ ((stateM & 1) &* a)
-				let x4 = (state[n &- 1] & upperMask) | (state[0] & lowerMask)
-				state[n &- 1] = state[m &- 1] ^ (x4 >> 1) ^ ((state[0] & 1) &* a)
+				MersenneTwister.twist(state)
 			} }
 			
 			index = 0
 		}
 		
-		var result = withUnsafePointer(to: &state_internal) { $0.withMemoryRebound(to: UInt64.self, capacity: MersenneTwister.stateCount) { ptr in
+		let result = withUnsafePointer(to: &state_internal) { $0.withMemoryRebound(to: UInt64.self, capacity: MersenneTwister.stateCount) { ptr in
 			return ptr[index]
 		} }
 		index = index &+ 1
 
+		return MersenneTwister.temper(result)
+	}
+	
+	/// Fills the buffer with the same sequence of words that repeated calls to `next()` would return (followed by the leading bytes of one further word if the buffer's size is not a multiple of 8).
+	/// Whole blocks of state are regenerated at a time and tempered directly into the buffer, which is substantially faster than calling `next()` per-word when filling large buffers.
+	public mutating func randomize(buffer: UnsafeMutableRawBufferPointer) {
+		guard let base = buffer.baseAddress else { return }
+		let wordSize = MemoryLayout<UInt64>.size
+		let wordCount = buffer.count / wordSize
+		if Int(bitPattern: base) % MemoryLayout<UInt64>.alignment == 0 {
+			let n = MersenneTwister.stateCount
+			var (i, offset) = (index, 0)
+			withUnsafeMutablePointer(to: &state_internal) { $0.withMemoryRebound(to: UInt64.self, capacity: n) { state in
+				while offset < wordCount {
+					if i == n {
+						MersenneTwister.twist(state)
+						i = 0
+					}
+					let count = Swift.min(n &- i, wordCount &- offset)
+					MersenneTwister.temper(state + i, into: base + offset &* wordSize, count: count)
+					(i, offset) = (i &+ count, offset &+ count)
+				}
+			} }
+			index = i
+		} else {
+			for offset in 0..<wordCount {
+				var word = next()
+				memcpy(base + offset &* wordSize, &word, wordSize)
+			}
+		}
+		
+		let remainder = buffer.count &- wordCount &* wordSize
+		if remainder > 0 {
+			var word = next()
+			memcpy(base + wordCount &* wordSize, &word, remainder)
+		}
+	}
+	
+	// Regenerates all words of the state in place.
+	// - Parameter state: pointer to `stateCount` words of state
+	private static func twist(_ state: UnsafeMutablePointer<UInt64>) {
+		let n = MersenneTwister.stateCount
+		let m = n / 2
+		let a: UInt64 = 0xB5026F5AA96619E9
+		let lowerMask: UInt64 = (1 << 31) - 1
+		let upperMask: UInt64 = ~lowerMask
+		var (i, j, stateM) = (0, m, state[m])
+		repeat {
+			let x1 = (state[i] & upperMask) | (state[i &+ 1] & lowerMask)
+			state[i] = state[i &+ m] ^ (x1 >> 1) ^ ((state[i &+ 1] & 1) &* a)
+			let x2 = (state[j] & upperMask) | (state[j &+ 1] & lowerMask)
+			state[j] = state[j &- m] ^ (x2 >> 1) ^ ((state[j &+ 1] & 1) &* a)
+			(i, j) = (i &+ 1, j &+ 1)
+		} while i != m &- 1
+		
+		let x3 = (state[m &- 1] & upperMask) | (stateM & lowerMask)
+		state[m &- 1] = state[n &- 1] ^ (x3 >> 1) ^ ((stateM & 1) &* a)
+		let x4 = (state[n &- 1] & upperMask) | (state[0] & lowerMask)
+		state[n &- 1] = state[m &- 1] ^ (x4 >> 1) ^ ((state[0] & 1) &* a)
+	}
+	
+	@inline(__always)
+	private static func temper(_ value: UInt64) -> UInt64 {
+		var result = value
 		result ^= (result >> 29) & 0x5555555555555555
 		result ^= (result << 17) & 0x71D67FFFEDA60000
 		result ^= (result << 37) & 0xFFF7EEE000000000
 		result ^= result >> 43
-
 		return result
 	}
+	
+	// Tempers a run of state words into an output buffer. There is no dependency between words, so the optimizer vectorizes this loop (SSE/AVX2 on x86_64, NEON on arm64).
+	// - Parameters:
+	//   - state: first state word to temper
+	//   - out: 8-byte aligned destination for `count` words
+	//   - count: number of words
+	@inline(__always)
+	private static func temper(_ state: UnsafePointer<UInt64>, into out: UnsafeMutableRawPointer, count: Int) {
+		for k in 0..<count {
+			out.storeBytes(of: temper(state[k]), toByteOffset: k &* MemoryLayout<UInt64>.size, as: UInt64.self)
+		}
+	}
 }
@@ -0,0 +1,427 @@
+//
+//  CwlSegmentedDeque.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+
+/// A Double-Ended Queue stored as a sequence of fixed-size chunks (4KB each) rather than a single contiguous buffer.
+///
+/// Compared to `Deque`:
+/// * growth allocates one chunk at a time and never moves existing elements, so a large burst doesn't cause repeated reallocate-and-move spikes
+/// * a chunk is released as soon as it is emptied from either end, so a queue that drains after a burst gives its memory back
+/// * released chunks are recycled through a small per-thread pool, so steady-state appending and removing rarely touches the allocator
+/// * `removeFirst(_:)` and `drain(into:maxCount:)` remove runs of elements a chunk at a time
+///
+/// Insertion or removal at the ends is O(1) but insertion or removal away from the ends is O(n).
+public struct SegmentedDeque<T>: RandomAccessCollection, MutableCollection, RangeReplaceableCollection, ExpressibleByArrayLiteral, CustomDebugStringConvertible {
+	public typealias Index = Int
+	public typealias Indices = CountableRange<Int>
+	public typealias Element = T
+	
+	private var storage: SegmentedDequeStorage<T>? = nil
+	
+	/// Implementation of RangeReplaceableCollection function
+	public init() {
+	}
+	
+	/// Implementation of ExpressibleByArrayLiteral function
+	public init(arrayLiteral: T...) {
+		append(contentsOf: arrayLiteral)
+	}
+	
+	/// Implementation of CustomDebugStringConvertible function
+	public var debugDescription: String {
+		var result = "\(type(of: self))(["
+		var iterator = makeIterator()
+		if let next = iterator.next() {
+			debugPrint(next, terminator: "", to: &result)
+			while let n = iterator.next() {
+				result += ", "
+				debugPrint(n, terminator: "", to: &result)
+			}
+		}
+		result += "])"
+		return result
+	}
+	
+	#if swift(>=4.1)
+		public subscript(bounds: Range<Index>) -> Slice<SegmentedDeque<T>> {
+			return Slice<SegmentedDeque<T>>(base: self, bounds: bounds)
+		}
+	#else
+		public subscript(bounds: Range<Index>) -> RangeReplaceableRandomAccessSlice<SegmentedDeque<T>> {
+			return RangeReplaceableRandomAccessSlice<SegmentedDeque<T>>(base: self, bounds: bounds)
+		}
+	#endif
+	
+	/// Implementation of RandomAccessCollection function
+	public subscript(_ at: Index) -> T {
+		get {
+			precondition(at >= 0 && at < count, "Index beyond bounds")
+			return storage!.address(at).pointee
+		}
+		set {
+			precondition(at >= 0 && at < count, "Index beyond bounds")
+			uniqueStorage().address(at).pointee = newValue
+		}
+	}
+	
+	/// Implementation of Collection function
+	public var startIndex: Index {
+		return 0
+	}
+	
+	/// Implementation of Collection function
+	public var endIndex: Index {
+		return storage?.count ?? 0
+	}
+	
+	/// Implementation of Collection function
+	public var isEmpty: Bool {
+		return endIndex == 0
+	}
+	
+	/// Implementation of Collection function
+	public var count: Int {
+		return endIndex
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	public mutating func append(_ newElement: T) {
+		uniqueStorage().append(newElement)
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	public mutating func append<S: Sequence>(contentsOf newElements: S) where S.Iterator.Element == T {
+		let s = uniqueStorage()
+		for e in newElements {
+			s.append(e)
+		}
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	public mutating func insert(_ newElement: T, at: Int) {
+		if at == 0 {
+			uniqueStorage().prepend(newElement)
+		} else if at == count {
+			uniqueStorage().append(newElement)
+		} else {
+			replaceSubrange(at..<at, with: CollectionOfOne(newElement))
+		}
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	@discardableResult
+	public mutating func remove(at: Int) -> T {
+		precondition(at >= 0 && at < count, "Index beyond bounds")
+		if at == 0 {
+			return uniqueStorage().removeFirst()
+		} else if at == count - 1 {
+			return uniqueStorage().removeLast()
+		}
+		let result = self[at]
+		replaceSubrange(at..<(at + 1), with: EmptyCollection())
+		return result
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	@discardableResult
+	public mutating func removeFirst() -> T {
+		precondition(!isEmpty, "Index beyond bounds")
+		return uniqueStorage().removeFirst()
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	@discardableResult
+	public mutating func removeLast() -> T {
+		precondition(!isEmpty, "Index beyond bounds")
+		return uniqueStorage().removeLast()
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function. Elements are deinitialized a chunk at a time and each emptied chunk is released.
+	public mutating func removeFirst(_ k: Int) {
+		precondition(k >= 0 && k <= count, "Index beyond bounds")
+		if k > 0 {
+			uniqueStorage().removeFirst(k)
+		}
+	}
+	
+	/// Optimized implementation of RangeReplaceableCollection function
+	public mutating func removeAll(keepingCapacity keepCapacity: Bool = false) {
+		if keepCapacity, isKnownUniquelyReferenced(&storage), let s = storage {
+			s.removeFirst(s.count)
+		} else {
+			storage = nil
+		}
+	}
+	
+	/// Moves elements from the front of the queue to the end of `destination`, a chunk at a time.
+	///
+	/// - Parameters:
+	///   - destination: receives the removed elements, in order
+	///   - maxCount: the maximum number of elements to move (default: all elements)
+	public mutating func drain<C: RangeReplaceableCollection>(into destination: inout C, maxCount: Int = Int.max) where C.Iterator.Element == T {
+		precondition(maxCount >= 0, "Count must not be negative")
+		let n = Swift.min(maxCount, count)
+		if n > 0 {
+			uniqueStorage().drain(into: &destination, count: n)
+		}
+	}
+	
+	/// Implemetation of the RangeReplaceableCollection function. Changes at either end of the queue are handled in place, other changes move the elements after the `subrange`.
+	public mutating func replaceSubrange<C>(_ subrange: Range<Int>, with newElements: C) where C: Collection, C.Iterator.Element == T {
+		precondition(subrange.lowerBound >= 0, "Subrange lowerBound is negative")
+		precondition(subrange.upperBound <= count, "Subrange upperBound is out of range")
+		
+		let s = uniqueStorage()
+		if subrange.lowerBound == 0 && subrange.upperBound != s.count {
+			s.removeFirst(subrange.count)
+			if !newElements.isEmpty {
+				for e in Array(newElements).reversed() {
+					s.prepend(e)
+				}
+			}
+		} else {
+			// Anything between the end of the `subrange` and the end of the queue is temporarily moved out
+			let tail = s.removeLast(s.count - subrange.upperBound)
+			let removed = s.removeLast(subrange.count)
+			withExtendedLifetime(removed) {}
+			for e in newElements {
+				s.append(e)
+			}
+			for e in tail {
+				s.append(e)
+			}
+		}
+	}
+	
+	// Returns the storage, having first created it (if `nil`) or copied it (if not uniquely referenced).
+	private mutating func uniqueStorage() -> SegmentedDequeStorage<T> {
+		// Uniqueness must be tested before binding `storage` (binding adds a reference)
+		if isKnownUniquelyReferenced(&storage), let s = storage {
+			return s
+		}
+		let s = storage?.copy() ?? SegmentedDequeStorage<T>()
+		storage = s
+		return s
+	}
+}
+
+// The chunks and layout for a `SegmentedDeque`. Elements occupy the range `head..<(head + count)` across the concatenated chunks. Chunks are always completely removed once no elements remain in them, so an empty queue holds no chunks (and `head == 0`).
+private final class SegmentedDequeStorage<T> {
+	var chunks = Deque<UnsafeMutablePointer<T>>()
+	var head = 0
+	var count = 0
+	
+	// The number of elements per chunk is rounded down to a power of two so that index mapping is a shift and mask. Constant folded when specialized.
+	static var chunkShift: Int {
+		let perChunk = Swift.max(1, SegmentedDequeChunkPool.chunkByteCount / Swift.max(1, MemoryLayout<T>.stride))
+		return (Int.bitWidth &- 1) &- perChunk.leadingZeroBitCount
+	}
+	
+	static var chunkCapacity: Int {
+		return 1 << chunkShift
+	}
+	
+	// Types too large or too strictly aligned for a standard chunk bypass the pool
+	static var pooled: Bool {
+		return MemoryLayout<T>.stride <= SegmentedDequeChunkPool.chunkByteCount && MemoryLayout<T>.alignment <= SegmentedDequeChunkPool.chunkAlignment
+	}
+	
+	deinit {
+		removeFirst(count)
+		for c in chunks {
+			SegmentedDequeStorage.release(c)
+		}
+	}
+	
+	@inline(__always)
+	func address(_ index: Int) -> UnsafeMutablePointer<T> {
+		let position = head &+ index
+		return chunks[position >> SegmentedDequeStorage.chunkShift].advanced(by: position & (SegmentedDequeStorage.chunkCapacity &- 1))
+	}
+	
+	func copy() -> SegmentedDequeStorage<T> {
+		let result = SegmentedDequeStorage<T>()
+		for i in 0..<count {
+			result.append(address(i).pointee)
+		}
+		return result
+	}
+	
+	func append(_ element: T) {
+		if head &+ count == chunks.count << SegmentedDequeStorage.chunkShift {
+			chunks.append(SegmentedDequeStorage.acquire())
+		}
+		address(count).initialize(to: element)
+		count = count &+ 1
+	}
+	
+	func prepend(_ element: T) {
+		if head == 0 {
+			chunks.insert(SegmentedDequeStorage.acquire(), at: 0)
+			head = SegmentedDequeStorage.chunkCapacity
+		}
+		head = head &- 1
+		count = count &+ 1
+		chunks[0].advanced(by: head).initialize(to: element)
+	}
+	
+	func removeFirst() -> T {
+		let result = address(0).move()
+		head = head &+ 1
+		count = count &- 1
+		trimFront()
+		return result
+	}
+	
+	func removeLast() -> T {
+		count = count &- 1
+		let result = address(count).move()
+		trimBack()
+		return result
+	}
+	
+	func removeFirst(_ n: Int) {
+		var remaining = n
+		while remaining > 0 {
+			let run = Swift.min(remaining, SegmentedDequeStorage.chunkCapacity &- head)
+			chunks[0].advanced(by: head).deinitialize(count: run)
+			head = head &+ run
+			count = count &- run
+			remaining = remaining &- run
+			trimFront()
+		}
+	}
+	
+	// Removes the last `n` elements, returning them in order
+	func removeLast(_ n: Int) -> Array<T> {
+		var result = Array<T>()
+		guard n > 0 else { return result }
+		result.reserveCapacity(n)
+		for i in (count &- n)..<count {
+			result.append(address(i).move())
+		}
+		count = count &- n
+		trimBack()
+		return result
+	}
+	
+	func drain<C: RangeReplaceableCollection>(into destination: inout C, count n: Int) where C.Iterator.Element == T {
+		var remaining = n
+		while remaining > 0 {
+			let run = Swift.min(remaining, SegmentedDequeStorage.chunkCapacity &- head)
+			let start = chunks[0].advanced(by: head)
+			destination.append(contentsOf: UnsafeBufferPointer(start: start, count: run))
+			start.deinitialize(count: run)
+			head = head &+ run
+			count = count &- run
+			remaining = remaining &- run
+			trimFront()
+		}
+	}
+	
+	// Releases the first chunk once all its elements are removed
+	@inline(__always)
+	private func trimFront() {
+		if count == 0 {
+			trimEmpty()
+		} else if head == SegmentedDequeStorage.chunkCapacity {
+			SegmentedDequeStorage.release(chunks.removeFirst())
+			head = 0
+		}
+	}
+	
+	// Releases any chunks after the last element
+	@inline(__always)
+	private func trimBack() {
+		if count == 0 {
+			trimEmpty()
+			return
+		}
+		let used = head &+ count
+		while (chunks.count &- 1) << SegmentedDequeStorage.chunkShift >= used {
+			SegmentedDequeStorage.release(chunks.removeLast())
+		}
+	}
+	
+	// When empty, all chunks are released (to the per-thread pool, where an immediate refill will reacquire them)
+	private func trimEmpty() {
+		while !chunks.isEmpty {
+			SegmentedDequeStorage.release(chunks.removeLast())
+		}
+		head = 0
+	}
+	
+	static func acquire() -> UnsafeMutablePointer<T> {
+		let raw: UnsafeMutableRawPointer
+		if pooled {
+			raw = SegmentedDequeChunkPool.current.chunks.popLast() ?? UnsafeMutableRawPointer.allocate(byteCount: SegmentedDequeChunkPool.chunkByteCount, alignment: SegmentedDequeChunkPool.chunkAlignment)
+		} else {
+			raw = UnsafeMutableRawPointer.allocate(byteCount: MemoryLayout<T>.stride &* chunkCapacity, alignment: MemoryLayout<T>.alignment)
+		}
+		return raw.bindMemory(to: T.self, capacity: chunkCapacity)
+	}
+	
+	static func release(_ chunk: UnsafeMutablePointer<T>) {
+		let raw = UnsafeMutableRawPointer(chunk)
+		if pooled {
+			let pool = SegmentedDequeChunkPool.current
+			if pool.chunks.count < SegmentedDequeChunkPool.maximumPooledChunks {
+				pool.chunks.append(raw)
+				return
+			}
+		}
+		raw.deallocate()
+	}
+}
+
+// A per-thread cache of uninitialized chunks, shared by `SegmentedDeque`s of all element types. The pool is limited to `maximumPooledChunks` so a thread that processed a large burst retains at most 64KB.
+private final class SegmentedDequeChunkPool {
+	static let chunkByteCount = 4096
+	static let chunkAlignment = 16
+	static let maximumPooledChunks = 16
+	
+	var chunks = Array<UnsafeMutableRawPointer>()
+	
+	deinit {
+		for c in chunks {
+			c.deallocate()
+		}
+	}
+	
+	static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		#if os(Linux)
+			pthread_key_create(&key) { Unmanaged<SegmentedDequeChunkPool>.fromOpaque($0!).release() }
+		#else
+			pthread_key_create(&key) { Unmanaged<SegmentedDequeChunkPool>.fromOpaque($0).release() }
+		#endif
+		return key
+	}()
+	
+	static var current: SegmentedDequeChunkPool {
+		if let existing = pthread_getspecific(key) {
+			return Unmanaged<SegmentedDequeChunkPool>.fromOpaque(existing).takeUnretainedValue()
+		}
+		let pool = SegmentedDequeChunkPool()
+		pthread_setspecific(key, Unmanaged.passRetained(pool).toOpaque())
+		return pool
+	}
+}
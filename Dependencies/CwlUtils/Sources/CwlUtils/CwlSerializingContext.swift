@@ -48,6 +48,10 @@ public struct SerializingContext: CustomExecutionContext {
 		underlying.invokeAsync { [mutex] in mutex.sync(execute: execute) }
 	}
 	
+	public var usesDispatchTimers: Bool {
+		return underlying.usesDispatchTimers
+	}
+	
 	@available(*, deprecated, message: "Use invokeSync instead")
 	public func invokeAndWait(_ execute: @escaping () -> Void) {
 		_ = invokeSync(execute)
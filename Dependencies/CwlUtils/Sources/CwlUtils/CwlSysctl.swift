@@ -143,6 +143,9 @@ public struct Sysctl {
 	/// e.g. "8" or "2"
 	public static var activeCPUs: Int32 { return try! Sysctl.value(ofType: Int32.self, forKeys: [CTL_HW, HW_AVAILCPU]) }
 	
+	/// e.g. "4" or "2" (excludes hyperthreads)
+	public static var physicalCPUs: Int32 { return try! Sysctl.value(ofType: Int32.self, forName: "hw.physicalcpu") }
+	
 	/// e.g. "15.3.0" or "15.0.0"
 	public static var osRelease: String { return try! Sysctl.string(for: [CTL_KERN, KERN_OSRELEASE]) }
 	
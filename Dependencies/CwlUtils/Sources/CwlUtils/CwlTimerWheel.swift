@@ -0,0 +1,292 @@
+//
+//  CwlTimerWheel.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+
+/// A timer that can be scheduled, rescheduled and cancelled any number of times. Each call to `schedule` replaces any pending (not yet fired) invocation of the handler.
+///
+/// Unlike the `Lifetime` returned from `Exec.singleTimer`, `cancel` is not terminal: a subsequent `schedule` starts the timer again. Releasing the last reference to the timer cancels it.
+public protocol ReschedulableTimer: class, Lifetime {
+	/// Run the handler after `interval`, replacing any pending invocation. An interval of `.never` is equivalent to `cancel`.
+	func schedule(interval: DispatchTimeInterval)
+}
+
+public extension Exec {
+	/// Constructs a `ReschedulableTimer` that runs `handler` on this context.
+	///
+	/// Contexts where `usesDispatchTimers` is true (Dispatch-based contexts, the pool and main-coalescing contexts and `SerializingContext` wrappers around them) use `TimerWheel.shared`, so scheduling and rescheduling are O(1) with no allocation. Other custom contexts (like `DebugContext`, which has its own notion of time) fall back to a new `singleTimer` for each `schedule`.
+	///
+	/// - Parameter handler: invoked on this context when the timer fires
+	/// - Returns: the unscheduled timer
+	func reschedulableTimer(handler: @escaping () -> Void) -> ReschedulableTimer {
+		if usesDispatchTimers {
+			return TimerWheel.shared.timer(context: self, handler: handler)
+		}
+		return SingleTimerRescheduler(context: self, handler: handler)
+	}
+}
+
+/// A hierarchical timing wheel (after Varghese and Lauck) that multiplexes any number of `ReschedulableTimer`s onto a single `DispatchSource`.
+///
+/// Scheduling, rescheduling and cancelling are O(1) and don't allocate once the timer exists. Each tick costs O(1) plus the timers that fire or cascade to a finer level on that tick. Time is quantized to `resolution`: timers never fire early but may fire up to one `resolution` late. The dispatch source is suspended whenever no timers are scheduled.
+///
+/// Handlers are invoked through each timer's `Exec`. For `.direct` that means on the wheel's own serial queue, where a slow handler will delay every other timer on the wheel.
+public final class TimerWheel {
+	/// A wheel with 1 millisecond resolution, used by `Exec.reschedulableTimer`
+	public static let shared = TimerWheel()
+	
+	// 4 levels of 64 slots covers 2^24 ticks (about 4.6 hours at 1 millisecond resolution). Timers further out are parked in the furthest top-level slot and re-evaluated when it cascades.
+	private static let bitsPerLevel: UInt64 = 6
+	private static let slotsPerLevel = 1 << Int(TimerWheel.bitsPerLevel)
+	private static let levelCount = 4
+	private static let slotMask = UInt64(TimerWheel.slotsPerLevel - 1)
+	
+	/// The duration of one tick, in nanoseconds
+	public let resolution: UInt64
+	
+	private let mutex = PThreadMutex()
+	private let source: DispatchSourceTimer
+	private var slots: [[TimerWheelEntry]]
+	private var spare: [TimerWheelEntry] = []
+	private var firing: [(entry: TimerWheelEntry, generation: Int)] = []
+	private var currentTick: UInt64 = 0
+	private var scheduledCount = 0
+	private var running = false
+	
+	/// Constructs a wheel. Typically, `TimerWheel.shared` should be used instead.
+	///
+	/// - Parameters:
+	///   - resolution: the duration of one tick (default: 1 millisecond)
+	///   - qos: quality-of-service for the wheel's queue (default: .default)
+	public init(resolution: DispatchTimeInterval = .milliseconds(1), qos: DispatchQoS = .default) {
+		self.resolution = UInt64(Swift.max(resolution.seconds * Double(NSEC_PER_SEC), 1))
+		self.slots = Array(repeating: [], count: TimerWheel.slotsPerLevel * TimerWheel.levelCount)
+		self.source = DispatchSource.makeTimerSource(queue: DispatchQueue(label: "CwlUtils.TimerWheel", qos: qos))
+		self.source.setEventHandler { [weak self] in self?.tick() }
+	}
+	
+	deinit {
+		// A dispatch source must not be released while suspended
+		if !running {
+			source.resume()
+		}
+		source.cancel()
+	}
+	
+	/// Constructs a `ReschedulableTimer` on this wheel.
+	///
+	/// - Parameters:
+	///   - context: where `handler` will be invoked (default: .direct)
+	///   - handler: invoked when the timer fires
+	/// - Returns: the unscheduled timer
+	public func timer(context: Exec = .direct, handler: @escaping () -> Void) -> ReschedulableTimer {
+		return TimerWheelTimer(wheel: self, entry: TimerWheelEntry(context: context, handler: handler))
+	}
+	
+	fileprivate func schedule(_ entry: TimerWheelEntry, interval: DispatchTimeInterval) {
+		if case .never = interval {
+			unschedule(entry)
+			return
+		}
+		let nanoseconds = (DispatchTime.now() + interval).uptimeNanoseconds
+		mutex.sync {
+			remove(entry)
+			entry.generation &+= 1
+			startIfNeeded()
+			entry.deadline = nanoseconds / resolution + (nanoseconds % resolution == 0 ? 0 : 1)
+			insert(entry, earliest: currentTick + 1)
+		}
+	}
+	
+	fileprivate func unschedule(_ entry: TimerWheelEntry) {
+		mutex.sync {
+			remove(entry)
+			entry.generation &+= 1
+		}
+	}
+	
+	// Must be invoked inside the mutex
+	private func startIfNeeded() {
+		guard !running else { return }
+		running = true
+		currentTick = DispatchTime.now().uptimeNanoseconds / resolution
+		let interval = DispatchTimeInterval.nanoseconds(Int(clamping: resolution))
+		source.schedule(deadline: .now() + interval, repeating: interval, leeway: .nanoseconds(Int(clamping: resolution / 2)))
+		source.resume()
+	}
+	
+	// Must be invoked inside the mutex.
+	//
+	// - Parameters:
+	//   - entry: an entry that is not currently in a slot
+	//   - earliest: the earliest tick the entry may occupy. Ordinarily this is the tick after `currentTick` (since the slot for `currentTick` has already been processed) but entries cascading from a higher level during `tick` may land in the slot about to be processed.
+	private func insert(_ entry: TimerWheelEntry, earliest: UInt64) {
+		let deadline = Swift.max(entry.deadline, earliest)
+		let delta = deadline - currentTick
+		var level = 0
+		while level < TimerWheel.levelCount - 1 && delta >> (TimerWheel.bitsPerLevel * UInt64(level + 1)) != 0 {
+			level += 1
+		}
+		var target = deadline
+		if delta >> (TimerWheel.bitsPerLevel * UInt64(TimerWheel.levelCount)) != 0 {
+			target = currentTick + (1 << (TimerWheel.bitsPerLevel * UInt64(TimerWheel.levelCount))) - 1
+		}
+		entry.slot = level * TimerWheel.slotsPerLevel + Int((target >> (TimerWheel.bitsPerLevel * UInt64(level))) & TimerWheel.slotMask)
+		entry.index = slots[entry.slot].count
+		slots[entry.slot].append(entry)
+		scheduledCount += 1
+	}
+	
+	// Must be invoked inside the mutex. Swaps the last entry in the slot into the removed position so removal is O(1).
+	private func remove(_ entry: TimerWheelEntry) {
+		guard entry.slot >= 0 else { return }
+		let last = slots[entry.slot].removeLast()
+		if last !== entry {
+			slots[entry.slot][entry.index] = last
+			last.index = entry.index
+		}
+		entry.slot = -1
+		scheduledCount -= 1
+	}
+	
+	// Must be invoked inside the mutex. Empties a slot, re-inserting (or, for level 0, collecting as due) each entry.
+	private func drain(slot: Int) {
+		swap(&spare, &slots[slot])
+		for entry in spare {
+			entry.slot = -1
+			scheduledCount -= 1
+			if entry.deadline <= currentTick {
+				firing.append((entry: entry, generation: entry.generation))
+			} else {
+				insert(entry, earliest: currentTick)
+			}
+		}
+		spare.removeAll(keepingCapacity: true)
+	}
+	
+	// Invoked on the wheel's queue by the dispatch source. Catches up on any ticks missed since the last invocation, then invokes the handlers of due timers outside the mutex.
+	private func tick() {
+		let target = DispatchTime.now().uptimeNanoseconds / resolution
+		mutex.sync {
+			while currentTick < target {
+				currentTick += 1
+				var level = 1
+				while level < TimerWheel.levelCount && currentTick & ((1 << (TimerWheel.bitsPerLevel * UInt64(level))) - 1) == 0 {
+					drain(slot: level * TimerWheel.slotsPerLevel + Int((currentTick >> (TimerWheel.bitsPerLevel * UInt64(level))) & TimerWheel.slotMask))
+					level += 1
+				}
+				drain(slot: Int(currentTick & TimerWheel.slotMask))
+			}
+			if scheduledCount == 0 && running {
+				running = false
+				source.suspend()
+			}
+		}
+		
+		// Only `tick` touches `firing` and it always runs on the wheel's serial queue, so it's safe to read outside the mutex
+		for (entry, generation) in firing {
+			entry.context.invoke { [mutex] in
+				// The timer may have been rescheduled or cancelled between leaving the wheel and entering its context
+				if mutex.sync(execute: { entry.generation == generation && entry.slot < 0 }) {
+					entry.handler()
+				}
+			}
+		}
+		firing.removeAll(keepingCapacity: true)
+	}
+}
+
+// The wheel's record of a timer. Held by the wheel while scheduled and by the `TimerWheelTimer` for its whole life. All mutable fields are protected by the wheel's mutex.
+private final class TimerWheelEntry {
+	let context: Exec
+	let handler: () -> Void
+	var deadline: UInt64 = 0
+	var slot = -1
+	var index = 0
+	var generation = 0
+	
+	init(context: Exec, handler: @escaping () -> Void) {
+		self.context = context
+		self.handler = handler
+	}
+}
+
+// The handle returned from `TimerWheel.timer`. This is separate from the `TimerWheelEntry` so the wheel's reference to a scheduled entry doesn't prevent release of the handle from cancelling the timer.
+private final class TimerWheelTimer: ReschedulableTimer {
+	let wheel: TimerWheel
+	let entry: TimerWheelEntry
+	
+	init(wheel: TimerWheel, entry: TimerWheelEntry) {
+		self.wheel = wheel
+		self.entry = entry
+	}
+	
+	func schedule(interval: DispatchTimeInterval) {
+		wheel.schedule(entry, interval: interval)
+	}
+	
+	func cancel() {
+		wheel.unschedule(entry)
+	}
+	
+	deinit {
+		cancel()
+	}
+}
+
+// A `ReschedulableTimer` for custom contexts that manage their own timers. Each `schedule` replaces the previous `singleTimer`.
+private final class SingleTimerRescheduler: ReschedulableTimer {
+	let context: Exec
+	let handler: () -> Void
+	let mutex = PThreadMutex()
+	var timer: Lifetime? = nil
+	
+	init(context: Exec, handler: @escaping () -> Void) {
+		self.context = context
+		self.handler = handler
+	}
+	
+	func schedule(interval: DispatchTimeInterval) {
+		if case .never = interval {
+			cancel()
+			return
+		}
+		let next = context.singleTimer(interval: interval, handler: handler)
+		replace(with: next)
+	}
+	
+	func cancel() {
+		replace(with: nil)
+	}
+	
+	// The previous timer is cancelled outside the mutex since cancelling may need to enter the context's own mutex
+	private func replace(with next: Lifetime?) {
+		var previous = mutex.sync { () -> Lifetime? in
+			let p = timer
+			timer = next
+			return p
+		}
+		previous?.cancel()
+	}
+	
+	deinit {
+		timer?.cancel()
+	}
+}
@@ -0,0 +1,375 @@
+//
+//  CwlUTF8Scanner.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#if os(Linux)
+	import Glibc
+#else
+	import Darwin
+#endif
+
+// `String.makeContiguousUTF8()` and `String.withUTF8(_:)` require Swift 5.1
+#if swift(>=5.1)
+
+/// A structure for traversing the UTF-8 bytes of a `String`, offering the same parsing operations as `ScalarScanner<String.UnicodeScalarView>` but working directly on contiguous UTF-8 storage.
+///
+/// Searches for ASCII scalars use `memchr` (which compares many bytes per instruction) and other searches compare raw bytes (UTF-8 is self-synchronizing, so a byte match for an encoded string always starts on a scalar boundary). Scalars are only decoded when a test closure or set requires it and a non-ASCII byte is encountered. Reads return `Substring`s sharing the storage of `string` rather than copying. The bounds of each `Substring` are the exact scalar positions scanned (a `Substring` may start or end inside a grapheme cluster), just as for `ScalarScanner`.
+///
+/// Unlike `ScalarScanner`, positions (`offset` and the positions in thrown `ScalarScannerError`s) are measured in UTF-8 bytes, not scalars.
+///
+/// **UNICODE WARNING**: as with `ScalarScanner`, this struct ignores all Unicode combining rules and parses each scalar individually.
+public struct UTF8Scanner {
+	/// The underlying storage
+	public let string: String
+	
+	/// Current scanning position, as a byte offset into `string.utf8`
+	public var offset: Int
+	
+	// Cached `string.utf8.count`
+	private let endOffset: Int
+	
+	/// Construct from a `String`. If the string is not already stored as contiguous UTF-8 (e.g. a bridged `NSString`), it is converted once, here.
+	public init(string: String) {
+		var s = string
+		s.makeContiguousUTF8()
+		self.string = s
+		self.offset = 0
+		self.endOffset = s.utf8.count
+	}
+	
+	/// The `String.Index` corresponding to `offset`
+	public var index: String.Index {
+		return stringIndex(offset)
+	}
+	
+	public var isAtEnd: Bool {
+		return offset == endOffset
+	}
+	
+	/// Sets the offset back to the beginning
+	public mutating func reset() {
+		offset = 0
+	}
+	
+	/// Throw if the scalars at the current `offset` don't match the scalars in `string`. Advance the `offset` to the end of the match.
+	/// WARNING: matching is purely based on direct byte comparison (no decomposition or normalization is performed).
+	public mutating func match(string: String) throws {
+		guard conditional(string: string) else {
+			throw ScalarScannerError.matchFailed(wanted: string, at: offset)
+		}
+	}
+	
+	/// Throw if the scalar at the current `offset` fails to match `scalar`. Advance the `offset` to the end of the match.
+	public mutating func match(scalar: UnicodeScalar) throws {
+		guard conditional(scalar: scalar) else {
+			throw ScalarScannerError.matchFailed(wanted: String(scalar), at: offset)
+		}
+	}
+	
+	/// Consume scalars up to but not including the first instance of `scalar` found. `offset` is advanced to immediately before `scalar`. Returns all scalars consumed prior to `scalar`. Throws if `scalar` is never found.
+	public mutating func readUntil(scalar: UnicodeScalar) throws -> Substring {
+		let start = offset
+		try skipUntil(scalar: scalar)
+		return substring(start, offset)
+	}
+	
+	/// Consume scalars up to but not including the first instance of `string` found. `offset` is advanced to immediately before `string`. Returns all scalars consumed prior to `string`. Throws if `string` is never found.
+	public mutating func readUntil(string: String) throws -> Substring {
+		let start = offset
+		try skipUntil(string: string)
+		return substring(start, offset)
+	}
+	
+	/// Consume scalars up to but not including the first instance of any scalar in `set` found. `offset` is advanced to immediately before that scalar. Returns all scalars consumed prior to that scalar. Throws if no scalar in `set` is ever found.
+	public mutating func readUntil(set inSet: Set<UnicodeScalar>) throws -> Substring {
+		let start = offset
+		try skipUntil(set: inSet)
+		return substring(start, offset)
+	}
+	
+	/// Peeks at the scalar at the current `offset`, testing it with `test`. While `test` returns `true`, the `offset` is advanced. Returns the scalars passed over.
+	public mutating func readWhile(true test: (UnicodeScalar) -> Bool) -> Substring {
+		let start = offset
+		skipWhile(true: test)
+		return substring(start, offset)
+	}
+	
+	/// Peeks at the scalar at the current `offset`, testing it with `test`. While `test` returns `true`, the `offset` is advanced.
+	public mutating func skipWhile(true test: (UnicodeScalar) -> Bool) {
+		offset = withBytes { bytes -> Int in
+			var i = offset
+			while i != endOffset {
+				let (scalar, length) = UTF8Scanner.scalar(at: i, in: bytes)
+				if !test(scalar) {
+					break
+				}
+				i += length
+			}
+			return i
+		}
+	}
+	
+	/// Consume scalars up to but not including the first instance of `scalar` found. `offset` is advanced to immediately before `scalar`. Throws if `scalar` is never found.
+	public mutating func skipUntil(scalar: UnicodeScalar) throws {
+		guard scalar.isASCII else {
+			return try skipUntil(string: String(scalar), wanted: String(scalar))
+		}
+		guard let found = withBytes({ UTF8Scanner.find(byte: UInt8(scalar.value), in: $0, from: offset) }) else {
+			throw ScalarScannerError.searchFailed(wanted: String(scalar), after: offset)
+		}
+		offset = found
+	}
+	
+	/// Consume scalars up to but not including the first instance of any scalar in `set` found. `offset` is advanced to immediately before that scalar. Throws if no scalar in `set` is ever found.
+	public mutating func skipUntil(set inSet: Set<UnicodeScalar>) throws {
+		// ASCII members are tested with a bitmap, one bit per byte value. Non-ASCII bytes are only decoded if the set has a non-ASCII member.
+		var asciiMembers: (low: UInt64, high: UInt64) = (0, 0)
+		var hasNonASCII = false
+		for s in inSet {
+			switch s.value {
+			case 0..<64: asciiMembers.low |= 1 << UInt64(s.value)
+			case 64..<128: asciiMembers.high |= 1 << UInt64(s.value - 64)
+			default: hasNonASCII = true
+			}
+		}
+		
+		let found = withBytes { bytes -> Int? in
+			var i = offset
+			while i != endOffset {
+				let b = bytes[i]
+				if b < 64 {
+					if asciiMembers.low & (1 << UInt64(b)) != 0 { return i }
+					i += 1
+				} else if b < 128 {
+					if asciiMembers.high & (1 << UInt64(b - 64)) != 0 { return i }
+					i += 1
+				} else {
+					let length = UTF8Scanner.scalarLength(leadByte: b)
+					if hasNonASCII && inSet.contains(UTF8Scanner.scalar(at: i, in: bytes).scalar) {
+						return i
+					}
+					i += length
+				}
+			}
+			return nil
+		}
+		guard let f = found else {
+			throw ScalarScannerError.searchFailed(wanted: "One of: \(inSet.sorted())", after: offset)
+		}
+		offset = f
+	}
+	
+	/// Consume scalars up to but not including the first instance of `string` found. `offset` is advanced to immediately before `string`. Throws if `string` is never found.
+	/// WARNING: matching is purely based on direct byte comparison (no decomposition or normalization is performed).
+	public mutating func skipUntil(string: String) throws {
+		try skipUntil(string: string, wanted: string)
+	}
+	
+	private mutating func skipUntil(string: String, wanted: String) throws {
+		var pattern = string
+		let found = pattern.withUTF8 { p -> Int? in
+			guard let first = p.first else { return offset }
+			return withBytes { bytes -> Int? in
+				var i = offset
+				while let candidate = UTF8Scanner.find(byte: first, in: bytes, from: i) {
+					if candidate + p.count > endOffset {
+						return nil
+					}
+					if p.count == 1 || memcmp(bytes.baseAddress! + candidate + 1, p.baseAddress! + 1, p.count - 1) == 0 {
+						return candidate
+					}
+					i = candidate + 1
+				}
+				return nil
+			}
+		}
+		guard let f = found else {
+			throw ScalarScannerError.searchFailed(wanted: wanted, after: offset)
+		}
+		offset = f
+	}
+	
+	/// Advance `offset` by `count` scalars. Throws (leaving `offset` unchanged) if the end is reached first.
+	public mutating func skip(count: Int = 1) throws {
+		offset = try withBytes { bytes -> Int in
+			var i = offset
+			for _ in 0..<count {
+				if i == endOffset {
+					throw ScalarScannerError.endedPrematurely(count: count, at: offset)
+				}
+				i += UTF8Scanner.scalarLength(leadByte: bytes[i])
+			}
+			return i
+		}
+	}
+	
+	/// Move `offset` back by `count` scalars. Throws (leaving `offset` unchanged) if the start is reached first.
+	public mutating func backtrack(count: Int = 1) throws {
+		offset = try withBytes { bytes -> Int in
+			var i = offset
+			for _ in 0..<count {
+				if i == 0 {
+					throw ScalarScannerError.endedPrematurely(count: -count, at: offset)
+				}
+				// Step back over continuation bytes (10xxxxxx) to the previous lead byte
+				repeat {
+					i -= 1
+				} while i > 0 && bytes[i] & 0xC0 == 0x80
+			}
+			return i
+		}
+	}
+	
+	/// Returns all content after the current `offset`. `offset` is advanced to the end.
+	public mutating func remainder() -> Substring {
+		let start = offset
+		offset = endOffset
+		return substring(start, offset)
+	}
+	
+	/// If the bytes after the current `offset` match the UTF-8 of `string`, advance over them and return `true`, otherwise, leave `offset` unchanged and return `false`.
+	public mutating func conditional(string: String) -> Bool {
+		var pattern = string
+		let matched = pattern.withUTF8 { p -> Bool in
+			guard !p.isEmpty else { return true }
+			guard offset + p.count <= endOffset else { return false }
+			return withBytes { bytes in memcmp(bytes.baseAddress! + offset, p.baseAddress!, p.count) == 0 }
+		}
+		if matched {
+			offset += string.utf8.count
+		}
+		return matched
+	}
+	
+	/// If the scalar at the current `offset` matches `scalar`, advance over it and return `true`, otherwise, leave `offset` unchanged and return `false`.
+	public mutating func conditional(scalar: UnicodeScalar) -> Bool {
+		guard scalar.isASCII else { return conditional(string: String(scalar)) }
+		let matched = withBytes { bytes in offset != endOffset && bytes[offset] == UInt8(scalar.value) }
+		if matched {
+			offset += 1
+		}
+		return matched
+	}
+	
+	/// If the `offset` is at the end, throw, otherwise, return the scalar at the current `offset` without advancing `offset`.
+	public func requirePeek() throws -> UnicodeScalar {
+		guard let s = peek() else {
+			throw ScalarScannerError.endedPrematurely(count: 1, at: offset)
+		}
+		return s
+	}
+	
+	/// If the `offset` is not at the end, return the scalar at the current `offset`, otherwise return `nil`. The `offset` will not be changed in any case.
+	public func peek() -> UnicodeScalar? {
+		guard offset != endOffset else { return nil }
+		return withBytes { UTF8Scanner.scalar(at: offset, in: $0).scalar }
+	}
+	
+	/// If the `offset` is at the end, throw, otherwise, return the scalar at the current `offset`, advancing `offset` past it.
+	public mutating func readScalar() throws -> UnicodeScalar {
+		guard offset != endOffset else {
+			throw ScalarScannerError.endedPrematurely(count: 1, at: offset)
+		}
+		let (scalar, length) = withBytes { UTF8Scanner.scalar(at: offset, in: $0) }
+		offset += length
+		return scalar
+	}
+	
+	/// Throws if the scalar at the current `offset` is not in the range `"0"` to `"9"`. Consume scalars `"0"` to `"9"` until a scalar outside that range is encountered. Return the integer representation of the value scanned, interpreted as a base 10 integer. `offset` is advanced to the end of the number.
+	public mutating func readInt() throws -> Int {
+		guard let r = conditionalInt() else {
+			throw ScalarScannerError.expectedInt(at: offset)
+		}
+		return r
+	}
+	
+	/// If the scalar at the current `offset` is in the range `"0"` to `"9"`, consume scalars `"0"` to `"9"` until a scalar outside that range is encountered and return the integer representation of the value scanned, interpreted as a base 10 integer. Otherwise (or if the value would overflow), returns `nil` and leaves `offset` unchanged.
+	public mutating func conditionalInt() -> Int? {
+		let parsed = withBytes { bytes -> (value: Int, end: Int)? in
+			var result = 0
+			var i = offset
+			while i != endOffset && bytes[i] >= 0x30 && bytes[i] <= 0x39 {
+				let digit = Int(bytes[i] - 0x30)
+				// Avoid overflow
+				if (Int.max - digit) / 10 < result {
+					return nil
+				}
+				result = result * 10 + digit
+				i += 1
+			}
+			return i == offset ? nil : (result, i)
+		}
+		guard let p = parsed else { return nil }
+		offset = p.end
+		return p.value
+	}
+	
+	/// Returns a throwable error capturing the current scanner progress point.
+	public func unexpectedError() -> ScalarScannerError {
+		return ScalarScannerError.unexpected(at: offset)
+	}
+	
+	// The storage was made contiguous in `init`, so `withContiguousStorageIfAvailable` never returns `nil`
+	private func withBytes<R>(_ body: (UnsafeBufferPointer<UInt8>) throws -> R) rethrows -> R {
+		return try string.utf8.withContiguousStorageIfAvailable(body)!
+	}
+	
+	// Native UTF-8 strings offset their `utf8` indices in constant time
+	private func stringIndex(_ byteOffset: Int) -> String.Index {
+		return string.utf8.index(string.utf8.startIndex, offsetBy: byteOffset)
+	}
+	
+	// Slicing through `unicodeScalars` keeps the scalar-aligned bounds. Subscripting the `String` directly would round them down to `Character` boundaries, dropping or adding combining scalars.
+	private func substring(_ start: Int, _ end: Int) -> Substring {
+		return Substring(string.unicodeScalars[stringIndex(start)..<stringIndex(end)])
+	}
+	
+	// Returns the offset of the first `byte` at or after `from`, using `memchr`.
+	private static func find(byte: UInt8, in bytes: UnsafeBufferPointer<UInt8>, from: Int) -> Int? {
+		guard from < bytes.count, let base = bytes.baseAddress else { return nil }
+		guard let found = memchr(base + from, Int32(byte), bytes.count - from) else { return nil }
+		return found.assumingMemoryBound(to: UInt8.self) - base
+	}
+	
+	// The number of bytes in the scalar starting with `leadByte`. The string is valid UTF-8, so the lead byte fully determines the length.
+	private static func scalarLength(leadByte b: UInt8) -> Int {
+		switch b {
+		case 0..<0x80: return 1
+		case 0x80..<0xE0: return 2
+		case 0xE0..<0xF0: return 3
+		default: return 4
+		}
+	}
+	
+	// Decodes the scalar starting at `i`, an offset of a lead byte in valid UTF-8.
+	private static func scalar(at i: Int, in bytes: UnsafeBufferPointer<UInt8>) -> (scalar: UnicodeScalar, length: Int) {
+		let b0 = bytes[i]
+		if b0 < 0x80 {
+			return (UnicodeScalar(b0), 1)
+		}
+		let length = scalarLength(leadByte: b0)
+		var value = UInt32(b0) & (0x7F >> UInt32(length))
+		for j in 1..<length {
+			value = (value << 6) | (UInt32(bytes[i + j]) & 0x3F)
+		}
+		return (UnicodeScalar(value) ?? "\u{FFFD}", length)
+	}
+}
+
+#endif
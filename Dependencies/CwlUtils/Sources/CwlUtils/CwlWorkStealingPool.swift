@@ -0,0 +1,333 @@
+//
+//  CwlWorkStealingPool.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+
+public extension Exec {
+	/// Invoked asynchronously and concurrently on `WorkStealingPool.shared`
+	static var pooled: Exec {
+		return WorkStealingPool.shared.concurrent
+	}
+	
+	/// Constructs a serial context on `WorkStealingPool.shared`, configured as an ExecutionType.serialAsync
+	static func pooledSerial() -> Exec {
+		return WorkStealingPool.shared.serial()
+	}
+}
+
+/// A fixed pool of worker threads (one per physical core, by default) that run work submitted through the contexts returned from `concurrent` and `serial()`.
+///
+/// Each worker owns a deque of jobs. Work submitted from a worker thread is queued on that worker (work submitted from other threads is distributed round-robin). A worker runs its own jobs oldest first and, when it has none, steals the newest job from another worker.
+///
+/// A serial context is a lane of work that is scheduled as a single drain job on the worker that last ran it, so a serial subgraph stays on one worker – and that worker's caches – unless an idle worker steals the lane. This is a logical affinity: workers are ordinary threads and are not bound to specific cores by the operating system.
+///
+/// Pools are expected to be long-lived: worker threads run for the lifetime of the process.
+public final class WorkStealingPool {
+	/// The default number of workers: the number of physical cores.
+	public static var defaultWorkerCount: Int {
+		#if os(Linux)
+			return ProcessInfo.processInfo.activeProcessorCount
+		#else
+			return Int(Sysctl.physicalCPUs)
+		#endif
+	}
+	
+	/// A pool with `defaultWorkerCount` workers.
+	public static let shared = WorkStealingPool()
+	
+	// The number of jobs a serial lane runs before yielding its worker to other queued jobs.
+	fileprivate static let laneBatchLimit = 64
+	
+	private var workers: [WorkStealingWorker] = []
+	private let mutex = PThreadMutex()
+	private let condition = PThreadCondition()
+	private var idleCount = 0
+	private var nextWorker = 0
+	
+	/// Constructs and starts a pool.
+	///
+	/// - Parameters:
+	///   - workerCount: number of worker threads
+	///   - qos: quality of service for the worker threads
+	public init(workerCount: Int = WorkStealingPool.defaultWorkerCount, qos: QualityOfService = .default) {
+		precondition(workerCount > 0, "A pool requires at least one worker")
+		workers = (0..<workerCount).map { WorkStealingWorker(pool: self, index: $0) }
+		for w in workers {
+			w.qualityOfService = qos
+			w.start()
+		}
+	}
+	
+	/// The number of worker threads.
+	public var workerCount: Int {
+		return workers.count
+	}
+	
+	/// A context, configured as an ExecutionType.concurrentAsync, which runs work on any worker.
+	public var concurrent: Exec {
+		return .custom(WorkStealingConcurrentContext(pool: self))
+	}
+	
+	/// Constructs a new serial lane, configured as an ExecutionType.serialAsync. Work invoked on the lane runs in order, one item at a time, preferring the worker that last ran the lane.
+	public func serial() -> Exec {
+		return .custom(WorkStealingLane(pool: self, home: nil))
+	}
+	
+	// Queues a job and wakes an idle worker.
+	//
+	// - Parameters:
+	//   - job: the work to run
+	//   - preferredWorker: index of the worker whose deque receives the job. If `nil`, the current worker (when called from one of this pool's workers) or the next worker by round-robin.
+	fileprivate func submit(_ job: @escaping () -> Void, preferredWorker: Int? = nil) {
+		let current = preferredWorker ?? WorkStealingWorker.current(in: self)?.index
+		mutex.unbalancedLock()
+		let target: Int
+		if let c = current {
+			target = c
+		} else {
+			target = nextWorker
+			nextWorker = (nextWorker + 1) % workers.count
+		}
+		workers[target].push(job)
+		if idleCount > 0 {
+			condition.signal()
+		}
+		mutex.unbalancedUnlock()
+	}
+	
+	// The loop run by each worker thread.
+	//
+	// - Parameter worker: the current worker
+	fileprivate func run(_ worker: WorkStealingWorker) {
+		while true {
+			if let job = worker.popOldest() ?? steal(excluding: worker.index) {
+				job()
+				continue
+			}
+			
+			// Workers only sleep after re-checking for work inside the pool mutex. Since `submit` queues work and checks `idleCount` inside the same mutex, a job cannot be queued between the check and the wait without the worker being woken.
+			mutex.unbalancedLock()
+			if !workers.contains(where: { $0.hasJobs }) {
+				idleCount += 1
+				condition.wait(mutex: mutex)
+				idleCount -= 1
+			}
+			mutex.unbalancedUnlock()
+		}
+	}
+	
+	// Waits for `semaphore` to be signalled on one of this pool's workers. Blocking the worker outright could deadlock, since the job that will signal may be queued on this worker (or every other worker may be blocked the same way), so queued jobs are run until it is signalled. If no jobs are queued anywhere, the awaited job is already running on another worker and blocking is safe.
+	//
+	// - Parameters:
+	//   - worker: the current worker
+	//   - semaphore: signalled when the wait is complete
+	fileprivate func help(_ worker: WorkStealingWorker, until semaphore: DispatchSemaphore) {
+		// Jobs run here are not part of the lane (if any) that this worker is running, so they must not run nested `invokeSync` calls on it directly.
+		let lane = worker.activeLane
+		worker.activeLane = nil
+		defer { worker.activeLane = lane }
+		
+		while semaphore.wait(timeout: .now()) == .timedOut {
+			if let job = worker.popOldest() ?? steal(excluding: worker.index) {
+				job()
+			} else {
+				semaphore.wait()
+				return
+			}
+		}
+	}
+	
+	private func steal(excluding index: Int) -> (() -> Void)? {
+		for offset in 1..<Swift.max(workers.count, 1) {
+			if let job = workers[(index + offset) % workers.count].popNewest() {
+				return job
+			}
+		}
+		return nil
+	}
+}
+
+// A worker thread and its deque of jobs.
+private final class WorkStealingWorker: Thread {
+	let pool: WorkStealingPool
+	let index: Int
+	
+	// Only accessed from this worker's thread. Used to detect nested `invokeSync` calls on a lane.
+	var activeLane: WorkStealingLane? = nil
+	
+	private let mutex = PThreadMutex()
+	private var jobs = Deque<() -> Void>()
+	
+	init(pool: WorkStealingPool, index: Int) {
+		self.pool = pool
+		self.index = index
+		super.init()
+		name = "CwlUtils.WorkStealingPool.worker\(index)"
+	}
+	
+	static func current(in pool: WorkStealingPool) -> WorkStealingWorker? {
+		guard let w = Thread.current as? WorkStealingWorker, w.pool === pool else { return nil }
+		return w
+	}
+	
+	var hasJobs: Bool {
+		return mutex.sync { !jobs.isEmpty }
+	}
+	
+	func push(_ job: @escaping () -> Void) {
+		mutex.sync { jobs.append(job) }
+	}
+	
+	func popOldest() -> (() -> Void)? {
+		return mutex.sync { jobs.isEmpty ? nil : jobs.removeFirst() }
+	}
+	
+	func popNewest() -> (() -> Void)? {
+		return mutex.sync { jobs.popLast() }
+	}
+	
+	override func main() {
+		pool.run(self)
+	}
+}
+
+// The `.concurrentAsync` context for a pool.
+private struct WorkStealingConcurrentContext: CustomExecutionContext {
+	let pool: WorkStealingPool
+	
+	var type: ExecutionType {
+		return .concurrentAsync
+	}
+	
+	var usesDispatchTimers: Bool {
+		return true
+	}
+	
+	func invoke(_ execute: @escaping () -> Void) {
+		pool.submit(execute)
+	}
+	
+	func invokeAsync(_ execute: @escaping () -> Void) {
+		pool.submit(execute)
+	}
+	
+	func invokeSync<Return>(_ execute: () throws -> Return) rethrows -> Return {
+		return try execute()
+	}
+	
+	func relativeAsync(qos: DispatchQoS.QoSClass?) -> Exec {
+		return .custom(self)
+	}
+}
+
+// A `.serialAsync` context for a pool. Work is queued on the lane and the lane is queued on a worker as a single drain job, so at most one item from the lane runs at any time.
+private final class WorkStealingLane: CustomExecutionContext {
+	let pool: WorkStealingPool
+	
+	private let mutex = PThreadMutex()
+	private var queued = Deque<() -> Void>()
+	private var scheduled = false
+	private var home: Int?
+	
+	init(pool: WorkStealingPool, home: Int?) {
+		self.pool = pool
+		self.home = home
+	}
+	
+	var type: ExecutionType {
+		return .serialAsync
+	}
+	
+	var usesDispatchTimers: Bool {
+		return true
+	}
+	
+	func invoke(_ execute: @escaping () -> Void) {
+		mutex.unbalancedLock()
+		queued.append(execute)
+		let needsSchedule = !scheduled
+		scheduled = true
+		let preferred = home
+		mutex.unbalancedUnlock()
+		
+		if needsSchedule {
+			pool.submit({ self.drain() }, preferredWorker: preferred)
+		}
+	}
+	
+	func invokeAsync(_ execute: @escaping () -> Void) {
+		invoke(execute)
+	}
+	
+	func invokeSync<Return>(_ execute: () throws -> Return) rethrows -> Return {
+		// A nested `invokeSync` would deadlock on a `.serialAsync` context; since the lane is already running on this thread, run directly instead.
+		if let w = WorkStealingWorker.current(in: pool), w.activeLane === self {
+			return try execute()
+		}
+		return try withoutActuallyEscaping(execute) { ex in
+			var r: Result<Return, Error>? = nil
+			let s = DispatchSemaphore(value: 0)
+			invoke {
+				r = Result { try ex() }
+				s.signal()
+			}
+			if let w = WorkStealingWorker.current(in: pool) {
+				pool.help(w, until: s)
+			} else {
+				s.wait()
+			}
+			return try r!.get()
+		}
+	}
+	
+	func relativeAsync(qos: DispatchQoS.QoSClass?) -> Exec {
+		return pool.concurrent
+	}
+	
+	// Runs up to `laneBatchLimit` queued items on the current worker, then either marks the lane idle or requeues the drain job (behind any other work on this worker).
+	private func drain() {
+		guard let worker = WorkStealingWorker.current(in: pool) else { return }
+		
+		// A drain run by `help` is nested inside another lane's item, so restore that lane afterwards.
+		let previous = worker.activeLane
+		worker.activeLane = self
+		defer { worker.activeLane = previous }
+		
+		var remaining = WorkStealingPool.laneBatchLimit
+		mutex.unbalancedLock()
+		
+		// If the lane was stolen, it now belongs to the thief.
+		home = worker.index
+		while remaining > 0, !queued.isEmpty {
+			let item = queued.removeFirst()
+			remaining -= 1
+			mutex.unbalancedUnlock()
+			item()
+			mutex.unbalancedLock()
+		}
+		if queued.isEmpty {
+			scheduled = false
+			mutex.unbalancedUnlock()
+		} else {
+			mutex.unbalancedUnlock()
+			pool.submit({ self.drain() }, preferredWorker: worker.index)
+		}
+	}
+}
@@ -21,12 +21,15 @@
 #define ReferenceRandomGenerators_h
 
 #import <stdint.h>
+#import <stddef.h>
 
 typedef struct {
 	uint64_t s[4];
 } xoshiro_state;
 
 uint64_t xoshiro_next(xoshiro_state *s);
+void xoshiro_jump(xoshiro_state *s);
+void xoshiro_long_jump(xoshiro_state *s);
 
 struct mt19937_64 {
 	unsigned long long mt[312];
@@ -35,6 +38,7 @@ struct mt19937_64 {
 
 void init_genrand64(struct mt19937_64* context, unsigned long long seed);
 unsigned long long genrand64_int64(struct mt19937_64* context);
+void genrand64_fill(struct mt19937_64* context, unsigned long long *out, size_t n);
 double genrand64_real1(struct mt19937_64* context);
 double genrand64_real2(struct mt19937_64* context);
 
@@ -55,9 +55,16 @@
 
 
 #include <stdio.h>
+#include <stddef.h>
 #include <mach/mach.h>
 #include <mach/mach_time.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #define NN 312
 #define MM 156
 #define MATRIX_A 0xB5026F5AA96619E9ULL
@@ -111,6 +118,81 @@ void init_by_array64(struct mt19937_64* context, unsigned long long init_key[],
     context->mt[0] = 1ULL << 63; /* MSB is 1; assuring non-zero initial array */ 
 }
 
+/* regenerates all NN words of the state in place */
+static void genrand64_twist(struct mt19937_64* context)
+{
+	size_t i;
+	size_t j;
+	size_t mid = NN / 2;
+	unsigned long long stateMid = context->mt[mid];
+	unsigned long long x;
+	unsigned long long y;
+	
+	/* NOTE: this "untwist" code is modified from the original to improve
+	 * performance, as described here:
+	 * http://www.cocoawithlove.com/blog/2016/05/19/random-numbers.html
+	 * These modifications are offered for use under the original icense at
+	 * the top of this file.
+	 */
+	for (i = 0, j = mid; i != mid - 1; i++, j++) {
+		x = (context->mt[i] & UM) | (context->mt[i + 1] & LM);
+		context->mt[i] = context->mt[i + mid] ^ (x >> 1) ^ ((context->mt[i + 1] & 1) * MATRIX_A);
+		y = (context->mt[j] & UM) | (context->mt[j + 1] & LM);
+		context->mt[j] = context->mt[j - mid] ^ (y >> 1) ^ ((context->mt[j + 1] & 1) * MATRIX_A);
+	}
+	x = (context->mt[mid - 1] & UM) | (stateMid & LM);
+	context->mt[mid - 1] = context->mt[NN - 1] ^ (x >> 1) ^ ((stateMid & 1) * MATRIX_A);
+	y = (context->mt[NN - 1] & UM) | (context->mt[0] & LM);
+	context->mt[NN - 1] = context->mt[mid - 1] ^ (y >> 1) ^ ((context->mt[0] & 1) * MATRIX_A);
+	
+	context->mti = 0;
+}
+
+/* tempers count words from state into out (which must not overlap state) */
+static void genrand64_temper(const unsigned long long *state, unsigned long long *out, size_t count)
+{
+	size_t i = 0;
+	unsigned long long x;
+	
+	/* NOTE: the tempering step has no dependency between words so it is applied to multiple words at
+	 * a time where the vector units allow. Any remainder (or all the words, on other architectures) is
+	 * handled by the scalar loop which is written so the compiler can auto-vectorize it.
+	 */
+	#if defined(__AVX2__)
+		const __m256i m1 = _mm256_set1_epi64x(0x5555555555555555LL);
+		const __m256i m2 = _mm256_set1_epi64x(0x71D67FFFEDA60000LL);
+		const __m256i m3 = _mm256_set1_epi64x((long long)0xFFF7EEE000000000ULL);
+		for (; i + 4 <= count; i += 4) {
+			__m256i v = _mm256_loadu_si256((const __m256i *)(state + i));
+			v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_srli_epi64(v, 29), m1));
+			v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_slli_epi64(v, 17), m2));
+			v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_slli_epi64(v, 37), m3));
+			v = _mm256_xor_si256(v, _mm256_srli_epi64(v, 43));
+			_mm256_storeu_si256((__m256i *)(out + i), v);
+		}
+	#elif defined(__ARM_NEON)
+		const uint64x2_t m1 = vdupq_n_u64(0x5555555555555555ULL);
+		const uint64x2_t m2 = vdupq_n_u64(0x71D67FFFEDA60000ULL);
+		const uint64x2_t m3 = vdupq_n_u64(0xFFF7EEE000000000ULL);
+		for (; i + 2 <= count; i += 2) {
+			uint64x2_t v = vld1q_u64((const uint64_t *)(state + i));
+			v = veorq_u64(v, vandq_u64(vshrq_n_u64(v, 29), m1));
+			v = veorq_u64(v, vandq_u64(vshlq_n_u64(v, 17), m2));
+			v = veorq_u64(v, vandq_u64(vshlq_n_u64(v, 37), m3));
+			v = veorq_u64(v, vshrq_n_u64(v, 43));
+			vst1q_u64((uint64_t *)(out + i), v);
+		}
+	#endif
+	for (; i < count; i++) {
+		x = state[i];
+		x ^= (x >> 29) & 0x5555555555555555ULL;
+		x ^= (x << 17) & 0x71D67FFFEDA60000ULL;
+		x ^= (x << 37) & 0xFFF7EEE000000000ULL;
+		x ^= (x >> 43);
+		out[i] = x;
+	}
+}
+
 /* generates a random number on [0, 2^64-1]-interval */
 unsigned long long genrand64_int64(struct mt19937_64* context)
 {
@@ -151,34 +233,10 @@ unsigned long long genrand64_int64(struct mt19937_64* context)
 		return x;
 	#else
 		/* This is the altered Cocoa with Love implementation. */
-		 size_t i;
-		 size_t j;
 		 unsigned long long result;
 
 		 if (context->mti >= NN) {/* generate NN words at one time */
-			size_t mid = NN / 2;
-			unsigned long long stateMid = context->mt[mid];
-			unsigned long long x;
-			unsigned long long y;
-
-			/* NOTE: this "untwist" code is modified from the original to improve
-			 * performance, as described here:
-			 * http://www.cocoawithlove.com/blog/2016/05/19/random-numbers.html
-			 * These modifications are offered for use under the original icense at
-			 * the top of this file.
-			 */
-			for (i = 0, j = mid; i != mid - 1; i++, j++) {
-				x = (context->mt[i] & UM) | (context->mt[i + 1] & LM);
-				context->mt[i] = context->mt[i + mid] ^ (x >> 1) ^ ((context->mt[i + 1] & 1) * MATRIX_A);
-				y = (context->mt[j] & UM) | (context->mt[j + 1] & LM);
-				context->mt[j] = context->mt[j - mid] ^ (y >> 1) ^ ((context->mt[j + 1] & 1) * MATRIX_A);
-			}
-			x = (context->mt[mid - 1] & UM) | (stateMid & LM);
-			context->mt[mid - 1] = context->mt[NN - 1] ^ (x >> 1) ^ ((stateMid & 1) * MATRIX_A);
-			y = (context->mt[NN - 1] & UM) | (context->mt[0] & LM);
-			context->mt[NN - 1] = context->mt[mid - 1] ^ (y >> 1) ^ ((context->mt[0] & 1) * MATRIX_A);
-
-			context->mti = 0;
+			genrand64_twist(context);
 		 }
 		
 		 result = context->mt[context->mti];
@@ -193,6 +251,25 @@ unsigned long long genrand64_int64(struct mt19937_64* context)
 	#endif
 }
 
+/* fills out with n random numbers on [0, 2^64-1]-interval. Produces the same sequence as n calls to genrand64_int64 */
+void genrand64_fill(struct mt19937_64* context, unsigned long long *out, size_t n)
+{
+	size_t count;
+	while (n > 0) {
+		if (context->mti >= NN) {
+			genrand64_twist(context);
+		}
+		count = NN - context->mti;
+		if (count > n) {
+			count = n;
+		}
+		genrand64_temper(context->mt + context->mti, out, count);
+		context->mti += count;
+		out += count;
+		n -= count;
+	}
+}
+
 	
 /* generates a random number on [0, 2^63-1]-interval */
 long long genrand64_int63(struct mt19937_64* context)
@@ -7,6 +7,7 @@ worldwide. This software is distributed without any warranty.
 See <http://creativecommons.org/publicdomain/zero/1.0/>. */
 
 #include <stdint.h>
+#include <stddef.h>
 
 /* This is xoshiro256** 1.0, our all-purpose, rock-solid generator. It has
    excellent (sub-ns) speed, a state (256 bits) that is large enough for
@@ -42,3 +43,60 @@ uint64_t xoshiro_next(xoshiro_state *state) {
 
 	return result_starstar;
 }
+
+/* This is the jump function for the generator. It is equivalent
+   to 2^128 calls to next(); it can be used to generate 2^128
+   non-overlapping subsequences for parallel computations. */
+
+void xoshiro_jump(xoshiro_state *state) {
+	static const uint64_t JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+	
+	uint64_t s0 = 0;
+	uint64_t s1 = 0;
+	uint64_t s2 = 0;
+	uint64_t s3 = 0;
+	for(size_t i = 0; i < sizeof JUMP / sizeof *JUMP; i++)
+		for(int b = 0; b < 64; b++) {
+			if (JUMP[i] & UINT64_C(1) << b) {
+				s0 ^= state->s[0];
+				s1 ^= state->s[1];
+				s2 ^= state->s[2];
+				s3 ^= state->s[3];
+			}
+			xoshiro_next(state);
+		}
+	
+	state->s[0] = s0;
+	state->s[1] = s1;
+	state->s[2] = s2;
+	state->s[3] = s3;
+}
+
+/* This is the long-jump function for the generator. It is equivalent to
+   2^192 calls to next(); it can be used to generate 2^64 starting points,
+   from each of which jump() will generate 2^64 non-overlapping
+   subsequences for parallel distributed computations. */
+
+void xoshiro_long_jump(xoshiro_state *state) {
+	static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
+	
+	uint64_t s0 = 0;
+	uint64_t s1 = 0;
+	uint64_t s2 = 0;
+	uint64_t s3 = 0;
+	for(size_t i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+		for(int b = 0; b < 64; b++) {
+			if (LONG_JUMP[i] & UINT64_C(1) << b) {
+				s0 ^= state->s[0];
+				s1 ^= state->s[1];
+				s2 ^= state->s[2];
+				s3 ^= state->s[3];
+			}
+			xoshiro_next(state);
+		}
+	
+	state->s[0] = s0;
+	state->s[1] = s1;
+	state->s[2] = s2;
+	state->s[3] = s3;
+}
@@ -66,4 +66,57 @@ class DequePerformanceTests: XCTestCase {
 			XCTAssert(accumulator == 0)
 		}
 	}
+	
+	func testSegmentedFIFOPerformance() {
+		measure { () -> Void in
+			var accumulator = 0
+			for _ in 1...outerCount {
+				var deque = SegmentedDeque<Int>()
+				for i in 1...innerCount {
+					deque.append(i)
+					accumulator ^= (deque.last ?? 0)
+				}
+				for _ in 1...innerCount {
+					accumulator ^= (deque.first ?? 0)
+					deque.remove(at: 0)
+				}
+			}
+			XCTAssert(accumulator == 0)
+		}
+	}
+	
+	// A burst large enough to force many reallocations of a contiguous `Deque`, followed by a complete drain
+	func testBurstPerformance() {
+		measure { () -> Void in
+			var accumulator = 0
+			var deque = Deque<Int>()
+			for _ in 1...(outerCount / 1_000 + 1) {
+				for i in 1...100_000 {
+					deque.append(i)
+				}
+				while let v = deque.first {
+					accumulator = accumulator &+ v
+					_ = deque.removeFirst()
+				}
+			}
+			XCTAssert(accumulator > 0)
+		}
+	}
+	
+	func testSegmentedBurstPerformance() {
+		measure { () -> Void in
+			var accumulator = 0
+			var deque = SegmentedDeque<Int>()
+			for _ in 1...(outerCount / 1_000 + 1) {
+				for i in 1...100_000 {
+					deque.append(i)
+				}
+				while let v = deque.first {
+					accumulator = accumulator &+ v
+					_ = deque.removeFirst()
+				}
+			}
+			XCTAssert(accumulator > 0)
+		}
+	}
 }
@@ -169,4 +169,50 @@ class MutexPerformanceTests: XCTestCase {
 			XCTAssert(total == iterations)
 		}
 	}
+	
+	@available(OSX 10.12, *)
+	func testAdaptiveMutexInlinePerformance() {
+		var lock = AdaptiveMutex.MutexPrimitive()
+		measure { () -> Void in
+			var total = 0
+			for _ in 0..<iterations {
+				AdaptiveMutex.lock(&lock, spinCount: AdaptiveMutex.defaultSpinCount)
+				total += 1
+				AdaptiveMutex.unlock(&lock)
+			}
+			XCTAssert(total == iterations)
+		}
+	}
+	
+	@available(OSX 10.12, *)
+	func testAdaptiveMutexContendedPerformance() {
+		let mutex = AdaptiveMutex()
+		measure { () -> Void in
+			var total = 0
+			DispatchQueue.concurrentPerform(iterations: 4) { _ in
+				for _ in 0..<(iterations / 40) {
+					mutex.sync {
+						total += 1
+					}
+				}
+			}
+			XCTAssert(total == iterations / 10)
+		}
+	}
+	
+	@available(OSX 10.12, *)
+	func testUnfairLockContendedPerformance() {
+		let mutex = UnfairLock()
+		measure { () -> Void in
+			var total = 0
+			DispatchQueue.concurrentPerform(iterations: 4) { _ in
+				for _ in 0..<(iterations / 40) {
+					mutex.sync {
+						total += 1
+					}
+				}
+			}
+			XCTAssert(total == iterations / 10)
+		}
+	}
 }
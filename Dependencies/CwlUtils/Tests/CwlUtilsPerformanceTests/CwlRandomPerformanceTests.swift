@@ -22,6 +22,7 @@ import XCTest
 import CwlUtils
 
 let PerformanceIterations = 100_000_000
+let PerformanceBufferWords = 1 << 20
 
 class RandomPerformanceTests: XCTestCase {
 	
@@ -37,6 +38,18 @@ class RandomPerformanceTests: XCTestCase {
 		}
 	}
 
+	func testDevRandomPooledDiv10() {
+		var generator = DevRandom(bufferSize: 16384)
+		
+		measure { () -> Void in
+			var sum: UInt64 = 0
+			for _ in 0..<(PerformanceIterations / 10) {
+				sum = sum &+ generator.next()
+			}
+			XCTAssert(sum != 0)
+		}
+	}
+	
 	func testArc4RandomDiv10() {
 		var generator = SystemRandomNumberGenerator()
 
@@ -132,6 +145,53 @@ class RandomPerformanceTests: XCTestCase {
 			XCTAssert(sum != 0)
 		}
 	}
+	
+	// The following tests fill an 8MB buffer repeatedly to generate `PerformanceIterations` words, comparing a per-word `next()` loop against block fills
+	let PerformanceBufferWords = 1 << 20
+	
+	func testMersenneTwisterNextIntoBuffer() {
+		var generator = MersenneTwister()
+		var buffer = Array<UInt64>(repeating: 0, count: PerformanceBufferWords)
+		
+		measure { () -> Void in
+			buffer.withUnsafeMutableBufferPointer { words in
+				for _ in 0..<(PerformanceIterations / PerformanceBufferWords) {
+					for i in 0..<words.count {
+						words[i] = generator.next()
+					}
+				}
+			}
+			XCTAssert(buffer[0] != 0 || buffer[1] != 0)
+		}
+	}
+	
+	func testMersenneTwisterRandomize() {
+		var generator = MersenneTwister()
+		var buffer = Array<UInt64>(repeating: 0, count: PerformanceBufferWords)
+		
+		measure { () -> Void in
+			buffer.withUnsafeMutableBytes { bytes in
+				for _ in 0..<(PerformanceIterations / PerformanceBufferWords) {
+					generator.randomize(buffer: bytes)
+				}
+			}
+			XCTAssert(buffer[0] != 0 || buffer[1] != 0)
+		}
+	}
+	
+	func testMT19937_64Fill() {
+		var generator = MT19937_64()
+		var buffer = Array<UInt64>(repeating: 0, count: PerformanceBufferWords)
+		
+		measure { () -> Void in
+			buffer.withUnsafeMutableBufferPointer { words in
+				for _ in 0..<(PerformanceIterations / PerformanceBufferWords) {
+					generator.fill(words.baseAddress!, count: words.count)
+				}
+			}
+			XCTAssert(buffer[0] != 0 || buffer[1] != 0)
+		}
+	}
 }
 
 //
@@ -155,6 +215,10 @@ private struct MT19937_64: RandomNumberGenerator {
 	mutating func next() -> UInt64 {
 		return genrand64_int64(&state)
 	}
+	
+	mutating func fill(_ words: UnsafeMutablePointer<UInt64>, count: Int) {
+		genrand64_fill(&state, words, count)
+	}
 }
 
 private struct Xoshiro256starstar: RandomNumberGenerator {
@@ -170,5 +234,13 @@ private struct Xoshiro256starstar: RandomNumberGenerator {
 	mutating func next() -> UInt64 {
 		return xoshiro_next(&state)
 	}
+	
+	mutating func jump() {
+		xoshiro_jump(&state)
+	}
+	
+	mutating func longJump() {
+		xoshiro_long_jump(&state)
+	}
 }
 
@@ -38,5 +38,20 @@ class AddressInfoTests: XCTestCase {
 		var a = symbolsForCallStack(addresses: callStackReturnAddresses())
 		a.remove(at: 0)
 		XCTAssert(a == b)
+		
+		// Repeated symbolication is served from the cache and produces identical output
+		var c = symbolsForCallStack(addresses: callStackReturnAddresses())
+		c.remove(at: 0)
+		XCTAssert(c == b)
+	}
+	
+	func testCachedAddressInfo() {
+		let address = callStackReturnAddresses(maximumAddresses: 1).first ?? 0
+		let direct = AddressInfo(address: address)
+		let cached = AddressInfo.cached(address: address)
+		XCTAssert(cached.address == direct.address)
+		XCTAssert(cached.symbol == direct.symbol)
+		XCTAssert(cached.offset == direct.offset)
+		XCTAssert(AddressInfo.cached(address: address).symbol == direct.symbol)
 	}
 }
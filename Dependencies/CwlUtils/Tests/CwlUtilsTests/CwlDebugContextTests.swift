@@ -453,6 +453,30 @@ class DebugContextTests: XCTestCase {
 		}
 	}
 
+	func testScheduleOrdering() {
+		let coordinator = DebugContextCoordinator()
+		let contexts = [coordinator.global, coordinator.main, coordinator.asyncQueue(), coordinator.asyncQueue()]
+		var results = [(time: UInt64, index: Int)]()
+		var timers = [Lifetime]()
+		for i in 0..<1000 {
+			// Many timers share each time so ties are common, both within and across threads
+			let interval = (i * 7919) % 97
+			timers.append(contexts[i % contexts.count].singleTimer(interval: .nanoseconds(interval), leeway: .nanoseconds(0)) {
+				results.append((time: coordinator.currentTime, index: i))
+			})
+		}
+		for i in stride(from: 0, to: timers.count, by: 3) {
+			timers[i].cancel()
+		}
+		coordinator.runScheduledTasks()
+		
+		// Cancelled timers don't run and the remainder run in time order, then in the order they were scheduled
+		let expected = (0..<1000).filter { $0 % 3 != 0 }.map { (time: UInt64(($0 * 7919) % 97), index: $0) }.sorted { $0.time < $1.time || ($0.time == $1.time && $0.index < $1.index) }
+		XCTAssert(results.map { $0.index } == expected.map { $0.index })
+		XCTAssert(results.map { $0.time } == expected.map { $0.time })
+		withExtendedLifetime(timers) {}
+	}
+	
 	#if false
 		func testTimeoutServiceSuccessHostTime() {
 			let ex = expectation(description: "Waiting for timeout callback")
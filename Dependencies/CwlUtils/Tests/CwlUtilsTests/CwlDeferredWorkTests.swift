@@ -264,6 +264,40 @@ class DeferredWorkTests: XCTestCase {
 		}
 	}
 
+	func testDeferredWorkSpill() {
+		// Beyond the inline capacity, work spills over into a buffer but order is preserved
+		var order = Array<Int>()
+		var dw1 = DeferredWork()
+		for i in 0..<10 {
+			dw1.append { order.append(i) }
+		}
+		var dw2 = DeferredWork { order.append(10) }
+		for i in 11..<16 {
+			dw2.append { order.append(i) }
+		}
+		dw1.append(dw2)
+		XCTAssert(order.isEmpty)
+		dw1.runWork()
+		XCTAssert(order == Array(0..<16))
+		
+		// The spill buffer returned to the cache is empty when reused and work is still released after running
+		order.removeAll()
+		var released = false
+		do {
+			let object = OnDelete { released = true }
+			var dw3 = DeferredWork()
+			for i in 0..<6 {
+				dw3.append { [object] in
+					withExtendedLifetime(object) {}
+					order.append(i)
+				}
+			}
+			dw3.runWork()
+		}
+		XCTAssert(released)
+		XCTAssert(order == Array(0..<6))
+	}
+	
 	func testDeferredWorkWithoutRunning() {
 		#if DEBUG
 			let e = catchBadInstruction {
@@ -272,4 +306,33 @@ class DeferredWorkTests: XCTestCase {
 			XCTAssert(e != nil)
 		#endif
 	}
+	
+	func testDeferredWorkSampledCallStack() {
+		let (depth, interval) = (DeferredWork.callStackDepth, DeferredWork.callStackSamplingInterval)
+		defer { (DeferredWork.callStackDepth, DeferredWork.callStackSamplingInterval) = (depth, interval) }
+		
+		// Unsampled instances must still detect work that is never run
+		DeferredWork.callStackSamplingInterval = 0
+		var dw1 = DeferredWork()
+		dw1.runWork()
+		#if DEBUG
+			let e1 = catchBadInstruction {
+				_ = DeferredWork()
+			}
+			XCTAssert(e1 != nil)
+		#endif
+		
+		DeferredWork.callStackDepth = 4
+		DeferredWork.callStackSamplingInterval = 3
+		for _ in 0..<10 {
+			var dw2 = DeferredWork()
+			dw2.runWork()
+		}
+		#if DEBUG
+			let e2 = catchBadInstruction {
+				_ = DeferredWork()
+			}
+			XCTAssert(e2 != nil)
+		#endif
+	}
 }
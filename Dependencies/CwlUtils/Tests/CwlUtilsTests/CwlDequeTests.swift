@@ -136,4 +136,22 @@ class DequeTests: XCTestCase {
 		deque.replaceSubrange(0..<8, with: [15, 16])
 		XCTAssert(Array(deque) == [15, 16, 13, 14])
 	}
+	
+	func testCopyOnWrite() {
+		var deque: Deque<Int> = [0, 1, 2]
+		deque.reserveCapacity(8)
+		
+		// Each fast path must leave an earlier copy untouched
+		let copy = deque
+		deque.append(3)
+		deque.insert(-1, at: 0)
+		XCTAssert(Array(copy) == [0, 1, 2])
+		
+		let copy2 = deque
+		deque.removeFirst()
+		deque.remove(at: deque.count - 1)
+		deque[0] = 10
+		XCTAssert(Array(copy2) == [-1, 0, 1, 2, 3])
+		XCTAssert(Array(deque) == [10, 1, 2])
+	}
 }
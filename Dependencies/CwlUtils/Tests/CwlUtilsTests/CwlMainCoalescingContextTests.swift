@@ -0,0 +1,68 @@
+//
+//  CwlMainCoalescingContextTests.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlUtils
+
+class MainCoalescingContextTests: XCTestCase {
+	func testExecutionType() {
+		let context = Exec.mainCoalesced
+		XCTAssert(context.type.isImmediateInCurrentContext == Thread.isMainThread)
+		XCTAssert(context.type.isSerial)
+		
+		var ran = false
+		context.invoke { ran = true }
+		XCTAssert(ran == Thread.isMainThread)
+		XCTAssert(context.invokeSync { 7 } == 7)
+	}
+	
+	func testCoalescedOrdering() {
+		let ex = expectation(description: "Waiting for all invocations")
+		var results = [Int]()
+		var onMain = true
+		DispatchQueue.global().async {
+			for i in 0..<10_000 {
+				Exec.mainCoalesced.invoke {
+					onMain = onMain && Thread.isMainThread
+					results.append(i)
+					if i == 9_999 {
+						ex.fulfill()
+					}
+				}
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(onMain)
+		XCTAssert(results == Array(0..<10_000))
+	}
+	
+	func testInvokeAsyncFromMain() {
+		let ex = expectation(description: "Waiting for async invocation")
+		var order = [Int]()
+		Exec.mainCoalesced.invokeAsync {
+			order.append(2)
+			ex.fulfill()
+		}
+		order.append(1)
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(order == [1, 2])
+	}
+}
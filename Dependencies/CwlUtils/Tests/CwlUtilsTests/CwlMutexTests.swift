@@ -60,6 +60,37 @@ class PthreadTests: XCTestCase {
 		
 		waitForExpectations(timeout: 0, handler: nil)
 	}
+	
+	func testAdaptiveMutex() {
+		let mutex = AdaptiveMutex()
+		
+		let e1 = expectation(description: "Block1 not invoked")
+		let r = mutex.sync { () -> Int in
+			e1.fulfill()
+			let reenter: Void? = mutex.trySync() {
+				XCTFail()
+			}
+			XCTAssert(reenter == nil)
+			return 13
+		}
+		XCTAssert(r == 13)
+		
+		// Contended increments must be serialized, whether acquired while spinning or after blocking
+		for spinCount in [0, AdaptiveMutex.defaultSpinCount] {
+			let contended = AdaptiveMutex(spinCount: spinCount)
+			var total = 0
+			DispatchQueue.concurrentPerform(iterations: 8) { _ in
+				for _ in 0..<10_000 {
+					contended.sync {
+						total += 1
+					}
+				}
+			}
+			XCTAssert(total == 80_000)
+		}
+		
+		waitForExpectations(timeout: 0, handler: nil)
+	}
 }
 
 extension PThreadMutex {
@@ -45,6 +45,27 @@ class RandomTests: XCTestCase {
 		genericTest(generator: &generator)
 	}
 	
+	func testDevRandomPooled() {
+		var generator = DevRandom(bufferSize: 4096)
+		genericTest(generator: &generator)
+		
+		// Requests spanning a pool refill, exceeding the pool and not aligned to word size
+		for byteCount in [4093, 5000, 70000, 3] {
+			var bytes = Array<UInt8>(repeating: 0, count: byteCount + 1)
+			bytes.withUnsafeMutableBytes { generator.randomize(buffer: UnsafeMutableRawBufferPointer(rebasing: $0[1...])) }
+			XCTAssert(bytes[0] == 0)
+			if byteCount > 64 {
+				XCTAssert(bytes[1...].contains { $0 != 0 })
+			}
+		}
+		
+		// A copy shares the pool but must not serve the same bytes as the original
+		var copy = generator
+		let a = (generator.next(), generator.next())
+		let b = (copy.next(), copy.next())
+		XCTAssert(a != b, "Technically, we *could* get a collision...")
+	}
+	
 	func testArc4Random() {
 		var generator = SystemRandomNumberGenerator()
 		genericTest(generator: &generator)
@@ -77,6 +98,41 @@ class RandomTests: XCTestCase {
 		}
 	}
 	
+	func testXoshiroJump() {
+		// Test jump and long jump against the reference implementation
+		var g1 = Xoshiro(seed: (12345678, 87654321, 10293847, 29384756))
+		var g2 = Xoshiro256starstar(seed: (12345678, 87654321, 10293847, 29384756))
+		g1.jump()
+		g2.jump()
+		for _ in 0..<VerificationIterations {
+			XCTAssert(g1.next() == g2.next())
+		}
+		g1.longJump()
+		g2.longJump()
+		for _ in 0..<VerificationIterations {
+			XCTAssert(g1.next() == g2.next())
+		}
+	}
+	
+	func testXoshiroStreams() {
+		let streams = Xoshiro.streams(count: 4, seed: (12345678, 87654321, 10293847, 29384756))
+		XCTAssert(streams.count == 4)
+		
+		// Each stream must start exactly one jump after the previous
+		var reference = Xoshiro256starstar(seed: (12345678, 87654321, 10293847, 29384756))
+		var outputs = Set<UInt64>()
+		for var stream in streams {
+			var r = reference
+			for _ in 0..<VerificationIterations {
+				let value = stream.next()
+				XCTAssert(value == r.next())
+				outputs.insert(value)
+			}
+			reference.jump()
+		}
+		XCTAssert(outputs.count == 4 * VerificationIterations, "Technically, we *could* get a collision...")
+	}
+	
 	func testXoshiro256starstar() {
 		var generator = Xoshiro256starstar()
 		genericTest(generator: &generator)
@@ -94,6 +150,58 @@ class RandomTests: XCTestCase {
 		}
 	}
 	
+	func testMersenneTwisterRandomize() {
+		// Block fills of assorted sizes (less than, equal to and greater than the 312 word state, with and without byte remainders) must match the reference per-word and block-fill output
+		let byteCounts = [8, 24, 2488, 2496, 2504, 8000, 16000, 5, 77]
+		var g1 = MersenneTwister(seed: 12345678)
+		var g2 = MT19937_64(seed: 12345678)
+		var g3 = MT19937_64(seed: 12345678)
+		for byteCount in byteCounts {
+			let wordCount = byteCount / MemoryLayout<UInt64>.size
+			var words = Array<UInt64>(repeating: 0, count: (byteCount + MemoryLayout<UInt64>.size - 1) / MemoryLayout<UInt64>.size)
+			words.withUnsafeMutableBytes { g1.randomize(buffer: UnsafeMutableRawBufferPointer(rebasing: $0[0..<byteCount])) }
+			
+			var reference = Array<UInt64>(repeating: 0, count: wordCount)
+			reference.withUnsafeMutableBufferPointer { g3.fill($0.baseAddress!, count: wordCount) }
+			for i in 0..<wordCount {
+				XCTAssert(words[i] == g2.next())
+				XCTAssert(words[i] == reference[i])
+			}
+			if wordCount < words.count {
+				let mask = (UInt64(1) << UInt64((byteCount - wordCount * MemoryLayout<UInt64>.size) * 8)) - 1
+				XCTAssert(words[wordCount] & mask == g2.next() & mask)
+				_ = g3.next()
+			}
+		}
+		
+		// Unaligned buffers take a different path but must produce the same sequence
+		var g4 = MersenneTwister(seed: 12345678)
+		var g5 = MT19937_64(seed: 12345678)
+		var bytes = Array<UInt8>(repeating: 0, count: 4000 * MemoryLayout<UInt64>.size + 1)
+		bytes.withUnsafeMutableBytes { g4.randomize(buffer: UnsafeMutableRawBufferPointer(rebasing: $0[1...])) }
+		bytes.withUnsafeBytes { raw in
+			for i in 0..<4000 {
+				var word: UInt64 = 0
+				memcpy(&word, raw.baseAddress! + 1 + i * MemoryLayout<UInt64>.size, MemoryLayout<UInt64>.size)
+				XCTAssert(word == g5.next())
+			}
+		}
+		
+		// Interleaving must pick up from the same position in the state
+		XCTAssert(g4.next() == g5.next())
+	}
+	
+	func testXoshiroRandomize() {
+		var g1 = Xoshiro(seed: (12345678, 87654321, 10293847, 29384756))
+		var g2 = Xoshiro256starstar(seed: (12345678, 87654321, 10293847, 29384756))
+		var words = Array<UInt64>(repeating: 0, count: VerificationIterations)
+		words.withUnsafeMutableBytes { g1.randomize(buffer: $0) }
+		for i in 0..<VerificationIterations {
+			XCTAssert(words[i] == g2.next())
+		}
+		XCTAssert(g1.next() == g2.next())
+	}
+	
 	func testMT19937_64() {
 		var generator = MT19937_64()
 		genericTest(generator: &generator)
@@ -230,6 +338,10 @@ private struct MT19937_64: RandomNumberGenerator {
 	mutating func next() -> UInt64 {
 		return genrand64_int64(&state)
 	}
+	
+	mutating func fill(_ words: UnsafeMutablePointer<UInt64>, count: Int) {
+		genrand64_fill(&state, words, count)
+	}
 }
 
 private struct Xoshiro256starstar: RandomNumberGenerator {
@@ -245,5 +357,13 @@ private struct Xoshiro256starstar: RandomNumberGenerator {
 	mutating func next() -> UInt64 {
 		return xoshiro_next(&state)
 	}
+	
+	mutating func jump() {
+		xoshiro_jump(&state)
+	}
+	
+	mutating func longJump() {
+		xoshiro_long_jump(&state)
+	}
 }
 
@@ -0,0 +1,156 @@
+//
+//  CwlSegmentedDequeTests.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlUtils
+
+class SegmentedDequeTests: XCTestCase {
+	func testAppend() {
+		var deque = SegmentedDeque<Result<Int, Error>>()
+		for i in 1...100 {
+			deque.append(.success(i))
+		}
+		XCTAssert(deque.count == 100)
+		
+		for i in 1...2_000 {
+			deque.remove(at: 0)
+			deque.append(.success(i))
+		}
+		for i in 1...2_000 {
+			deque.remove(at: deque.count - 1)
+			deque.insert(.success(i), at: 0)
+		}
+		
+		var i = 0
+		while deque.count > 0 {
+			deque.remove(at: 0)
+			i += 1
+		}
+		XCTAssert(i == 100)
+	}
+	
+	func testChunkBoundaries() {
+		// Enough values to span many chunks, checked after growth from both ends
+		var deque = SegmentedDeque<Int>()
+		for i in 0..<5_000 {
+			deque.append(i)
+		}
+		for i in 1...5_000 {
+			deque.insert(-i, at: 0)
+		}
+		XCTAssert(deque.count == 10_000)
+		XCTAssert(Array(deque) == Array(-5_000..<5_000))
+		XCTAssert(deque[0] == -5_000)
+		XCTAssert(deque[9_999] == 4_999)
+		
+		deque[5_000] = 100
+		XCTAssert(deque[5_000] == 100)
+		
+		while deque.count > 1 {
+			deque.removeLast()
+		}
+		XCTAssert(Array(deque) == [-5_000])
+		deque.removeFirst()
+		XCTAssert(deque.isEmpty)
+		
+		// An emptied deque is reusable from either end
+		deque.insert(1, at: 0)
+		deque.append(2)
+		XCTAssert(Array(deque) == [1, 2])
+	}
+	
+	func testBulkRemove() {
+		var deque = SegmentedDeque<Int>(0..<3_000)
+		deque.removeFirst(1_000)
+		XCTAssert(deque.count == 2_000)
+		XCTAssert(deque.first == 1_000)
+		
+		var drained = Array<Int>()
+		deque.drain(into: &drained, maxCount: 1_500)
+		XCTAssert(drained == Array(1_000..<2_500))
+		XCTAssert(Array(deque) == Array(2_500..<3_000))
+		
+		deque.drain(into: &drained)
+		XCTAssert(drained == Array(1_000..<3_000))
+		XCTAssert(deque.isEmpty)
+		
+		deque.drain(into: &drained)
+		XCTAssert(drained.count == 2_000)
+	}
+	
+	func testReleasesElements() {
+		// Every element removed by any means must be released exactly once
+		do {
+			var deque = SegmentedDeque<Tracked>()
+			for _ in 0..<1_000 {
+				deque.append(Tracked())
+			}
+			deque.removeFirst(300)
+			XCTAssert(Tracked.live == 700)
+			deque.replaceSubrange(100..<200, with: [Tracked()])
+			XCTAssert(Tracked.live == 601)
+			var drained = Array<Tracked>()
+			deque.drain(into: &drained, maxCount: 101)
+			XCTAssert(Tracked.live == 601)
+			drained.removeAll()
+			XCTAssert(Tracked.live == 500)
+			deque.removeAll(keepingCapacity: true)
+			XCTAssert(Tracked.live == 0)
+			for _ in 0..<10 {
+				deque.append(Tracked())
+			}
+		}
+		XCTAssert(Tracked.live == 0)
+	}
+	
+	func testCopyOnWrite() {
+		var a: SegmentedDeque<Int> = [1, 2, 3]
+		var b = a
+		b.append(4)
+		a.removeFirst()
+		XCTAssert(Array(a) == [2, 3])
+		XCTAssert(Array(b) == [1, 2, 3, 4])
+	}
+	
+	func testRangeReplacing() {
+		var deque: SegmentedDeque<Int> = [0, 1, 2]
+		deque.replaceSubrange(1..<1, with: [3, 4, 5, 6, 7, 8])
+		XCTAssert(Array(deque) == [0, 3, 4, 5, 6, 7, 8, 1, 2])
+		
+		deque.replaceSubrange(4..<6, with: [9, 10, 11, 12, 13])
+		XCTAssert(Array(deque) == [0, 3, 4, 5, 9, 10, 11, 12, 13, 8, 1, 2])
+		
+		deque.replaceSubrange(9..<12, with: [14])
+		XCTAssert(Array(deque) == [0, 3, 4, 5, 9, 10, 11, 12, 13, 14])
+		
+		deque.replaceSubrange(0..<8, with: [15, 16])
+		XCTAssert(Array(deque) == [15, 16, 13, 14])
+		
+		deque.replaceSubrange(0..<4, with: [17])
+		XCTAssert(Array(deque) == [17])
+	}
+}
+
+private class Tracked {
+	static var live = 0
+	init() { Tracked.live += 1 }
+	deinit { Tracked.live -= 1 }
+}
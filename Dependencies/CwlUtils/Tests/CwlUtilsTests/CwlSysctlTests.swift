@@ -53,6 +53,9 @@ class SysctlTests: XCTestCase {
 		let activeCPUs = Sysctl.activeCPUs
 		XCTAssert(activeCPUs > 0)
 		
+		let physicalCPUs = Sysctl.physicalCPUs
+		XCTAssert(physicalCPUs > 0 && physicalCPUs <= activeCPUs)
+		
 		#if os(macOS)
 			let osRev = Sysctl.osRev
 			XCTAssert(osRev != 0)
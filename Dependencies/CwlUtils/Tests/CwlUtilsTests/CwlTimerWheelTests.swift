@@ -0,0 +1,165 @@
+//
+//  CwlTimerWheelTests.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlUtils
+
+class TimerWheelTests: XCTestCase {
+	func testFires() {
+		let wheel = TimerWheel()
+		let ex = expectation(description: "Waiting for timer")
+		let start = DispatchTime.now()
+		let timer = wheel.timer {
+			XCTAssert(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds >= 10_000_000)
+			ex.fulfill()
+		}
+		timer.schedule(interval: .milliseconds(10))
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(timer) {}
+	}
+	
+	func testReschedule() {
+		let wheel = TimerWheel()
+		let ex = expectation(description: "Waiting for timer")
+		let start = DispatchTime.now()
+		var count = 0
+		let timer = wheel.timer {
+			count += 1
+			XCTAssert(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds >= 100_000_000)
+			ex.fulfill()
+		}
+		
+		// Each schedule replaces the previous so only the final, longest interval fires
+		timer.schedule(interval: .milliseconds(10))
+		timer.schedule(interval: .milliseconds(50))
+		timer.schedule(interval: .milliseconds(100))
+		waitForExpectations(timeout: 1e1, handler: nil)
+		
+		let settle = expectation(description: "Waiting for no further invocations")
+		DispatchQueue.global().asyncAfter(deadline: .now() + .milliseconds(50)) { settle.fulfill() }
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(count == 1)
+		withExtendedLifetime(timer) {}
+	}
+	
+	func testCancelAndRelease() {
+		let wheel = TimerWheel()
+		let cancelled = wheel.timer { XCTFail() }
+		cancelled.schedule(interval: .milliseconds(10))
+		cancelled.cancel()
+		do {
+			let released = wheel.timer { XCTFail() }
+			released.schedule(interval: .milliseconds(10))
+		}
+		
+		// A cancelled timer may be scheduled again
+		let ex = expectation(description: "Waiting for rescheduled timer")
+		let restarted = wheel.timer { ex.fulfill() }
+		restarted.schedule(interval: .milliseconds(10))
+		restarted.cancel()
+		restarted.schedule(interval: .milliseconds(30))
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(cancelled) {}
+		withExtendedLifetime(restarted) {}
+	}
+	
+	func testCascade() {
+		// At 100 microsecond resolution, these intervals land in each of the first three levels of the wheel
+		let wheel = TimerWheel(resolution: .microseconds(100))
+		let ex = expectation(description: "Waiting for timers")
+		let queue = DispatchQueue(label: "")
+		let start = DispatchTime.now()
+		let intervals = [2, 30, 500]
+		var fired = [Int]()
+		let timers = intervals.map { milliseconds in
+			wheel.timer {
+				XCTAssert(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds >= UInt64(milliseconds) * 1_000_000)
+				queue.sync { fired.append(milliseconds) }
+				if milliseconds == intervals.last {
+					ex.fulfill()
+				}
+			}
+		}
+		for (timer, milliseconds) in zip(timers, intervals).reversed() {
+			timer.schedule(interval: .milliseconds(milliseconds))
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		queue.sync { XCTAssert(fired == intervals) }
+		withExtendedLifetime(timers) {}
+	}
+	
+	func testManyTimers() {
+		let wheel = TimerWheel()
+		let ex = expectation(description: "Waiting for timers")
+		let queue = DispatchQueue(label: "")
+		let total = 10_000
+		var remaining = total
+		let timers = (0..<total).map { _ in
+			wheel.timer(context: .global) {
+				queue.sync {
+					remaining -= 1
+					if remaining == 0 {
+						ex.fulfill()
+					}
+				}
+			}
+		}
+		for (i, t) in timers.enumerated() {
+			t.schedule(interval: .milliseconds(1 + i % 50))
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(timers) {}
+	}
+	
+	func testExecFallback() {
+		// Debug contexts keep their own virtual time so they don't use the wheel
+		let coordinator = DebugContextCoordinator()
+		var times = [UInt64]()
+		let timer = coordinator.direct.reschedulableTimer {
+			times.append(coordinator.currentTime)
+		}
+		timer.schedule(interval: .seconds(5))
+		let reschedule = coordinator.direct.singleTimer(interval: .seconds(3)) {
+			timer.schedule(interval: .seconds(4))
+		}
+		coordinator.runScheduledTasks()
+		XCTAssert(times.count == 1)
+		XCTAssert(times.first.map { $0 >= 7_000_000_000 && $0 < 7_000_000_100 } == true)
+		withExtendedLifetime(reschedule) {}
+	}
+	
+	func testCustomContextsUseWheel() {
+		// The custom contexts that run on host time opt into the wheel; debug contexts don't
+		XCTAssert(Exec.pooled.usesDispatchTimers)
+		XCTAssert(Exec.pooledSerial().usesDispatchTimers)
+		XCTAssert(Exec.mainCoalesced.usesDispatchTimers)
+		XCTAssert(Exec.pooled.serialized().usesDispatchTimers)
+		XCTAssert(DebugContextCoordinator().direct.usesDispatchTimers == false)
+		
+		let ex = expectation(description: "Waiting for pooled timer")
+		let timer = Exec.pooledSerial().reschedulableTimer {
+			ex.fulfill()
+		}
+		timer.schedule(interval: .milliseconds(5))
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(timer) {}
+	}
+}
@@ -0,0 +1,114 @@
+//
+//  CwlUTF8ScannerTests.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlUtils
+
+#if swift(>=5.1)
+
+class UTF8ScannerTests: XCTestCase {
+	func testScalarBoundaries() {
+		// Reads end between a scalar and the combining scalar that follows it
+		var sc = UTF8Scanner(string: "e\u{301}x")
+		XCTAssert(sc.readWhile { $0 == "e" }.unicodeScalars.elementsEqual(["e"]))
+		XCTAssert(sc.remainder().unicodeScalars.elementsEqual(["\u{301}", "x"]))
+	}
+	
+	func testReadUntil() throws {
+		var sc = UTF8Scanner(string: "key=value;ключ=значение;end")
+		XCTAssert(try sc.readUntil(scalar: "=") == "key")
+		try sc.match(scalar: "=")
+		XCTAssert(try sc.readUntil(set: [";", ","]) == "value")
+		try sc.skip()
+		XCTAssert(try sc.readUntil(string: "=зна") == "ключ")
+		try sc.match(string: "=")
+		XCTAssert(try sc.readUntil(scalar: "ч") == "зна")
+		XCTAssert(sc.remainder() == "чение;end")
+		XCTAssert(sc.isAtEnd)
+		
+		do {
+			sc.reset()
+			try sc.skipUntil(scalar: "#")
+			XCTFail()
+		} catch ScalarScannerError.searchFailed(let wanted, let after) {
+			XCTAssert(wanted == "#")
+			XCTAssert(after == 0)
+		}
+	}
+	
+	func testReadUntilNonASCIISet() throws {
+		var sc = UTF8Scanner(string: "abcдеf→g")
+		XCTAssert(try sc.readUntil(set: ["→", "g"]) == "abcдеf")
+		XCTAssert(sc.offset == "abcдеf".utf8.count)
+		XCTAssert(try sc.readScalar() == "→")
+		XCTAssert(sc.peek() == "g")
+	}
+	
+	func testReadUntilStringPartialMatches() throws {
+		var sc = UTF8Scanner(string: "aababcabcd")
+		XCTAssert(try sc.readUntil(string: "abcd") == "aababc")
+		do {
+			try sc.skipUntil(string: "abcde")
+			XCTFail()
+		} catch ScalarScannerError.searchFailed(let wanted, let after) {
+			XCTAssert(wanted == "abcde")
+			XCTAssert(after == 6)
+		}
+	}
+	
+	func testReadWhileAndInt() throws {
+		var sc = UTF8Scanner(string: "12345 añb 99999999999999999999")
+		XCTAssert(try sc.readInt() == 12345)
+		sc.skipWhile { $0 == " " }
+		XCTAssert(sc.readWhile { $0 != " " } == "añb")
+		try sc.match(scalar: " ")
+		XCTAssert(sc.conditionalInt() == nil)
+		XCTAssert(sc.peek() == "9")
+	}
+	
+	func testSkipAndBacktrack() throws {
+		var sc = UTF8Scanner(string: "aé😀z")
+		try sc.skip(count: 3)
+		XCTAssert(sc.peek() == "z")
+		try sc.backtrack(count: 2)
+		XCTAssert(sc.peek() == "é")
+		XCTAssert(sc.conditional(scalar: "é"))
+		XCTAssert(sc.conditional(string: "😀z"))
+		XCTAssert(!sc.conditional(scalar: "z"))
+		XCTAssertThrowsError(try sc.skip())
+		XCTAssertThrowsError(try sc.readScalar())
+	}
+	
+	func testMatchesScalarScanner() throws {
+		// Both scanners should tokenize non-ASCII content identically
+		let text = (0..<100).map { "line \($0): naïve café ☕️ → ok\n" }.joined()
+		var a = UTF8Scanner(string: text)
+		var b = ScalarScanner(scalars: text.unicodeScalars)
+		while !a.isAtEnd {
+			XCTAssert(String(try a.readUntil(scalar: "\n")) == (try b.readUntil(scalar: "\n")))
+			try a.skip()
+			try b.skip()
+		}
+		XCTAssert(b.isAtEnd)
+	}
+}
+
+#endif
@@ -0,0 +1,132 @@
+//
+//  CwlWorkStealingPoolTests.swift
+//  CwlUtils
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlUtils
+
+class WorkStealingPoolTests: XCTestCase {
+	func testExecutionTypes() {
+		let pool = WorkStealingPool(workerCount: 2)
+		XCTAssert(pool.workerCount == 2)
+		
+		let concurrent = pool.concurrent
+		XCTAssert(concurrent.type.isConcurrent)
+		XCTAssert(concurrent.type.isPotentiallyAsync)
+		XCTAssert(concurrent.type.isReentrant)
+		
+		let serial = pool.serial()
+		XCTAssert(serial.type.isSerial)
+		XCTAssert(serial.type.isAsyncInCurrentContext)
+		XCTAssert(serial.type.isNonReentrant)
+		
+		XCTAssert(Exec.pooled.type.isConcurrent)
+		XCTAssert(Exec.pooledSerial().type.isSerial)
+	}
+	
+	func testConcurrent() {
+		let pool = WorkStealingPool(workerCount: 4)
+		let ex = expectation(description: "Waiting for all jobs")
+		let mutex = PThreadMutex()
+		var count = 0
+		for _ in 0..<1000 {
+			pool.concurrent.invoke {
+				let done = mutex.sync { () -> Bool in
+					count += 1
+					return count == 1000
+				}
+				if done {
+					ex.fulfill()
+				}
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+	}
+	
+	func testSerialOrderingAndExclusion() {
+		let pool = WorkStealingPool(workerCount: 4)
+		let serial = pool.serial()
+		let ex = expectation(description: "Waiting for all jobs")
+		let mutex = PThreadMutex()
+		var running = 0
+		var overlapped = false
+		var results = [Int]()
+		for i in 0..<1000 {
+			serial.invoke {
+				mutex.sync {
+					running += 1
+					overlapped = overlapped || running > 1
+				}
+				results.append(i)
+				mutex.sync { running -= 1 }
+				if i == 999 {
+					ex.fulfill()
+				}
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(!overlapped)
+		XCTAssert(results == Array(0..<1000))
+		
+		XCTAssert(serial.invokeSync { 7 } == 7)
+		XCTAssert(serial.invokeSync { serial.invokeSync { 11 } } == 11)
+	}
+	
+	func testInvokeSyncFromWorker() {
+		// With one worker, the lane's drain can only be queued on the worker that is waiting for it
+		let pool = WorkStealingPool(workerCount: 1)
+		let serial = pool.serial()
+		let other = pool.serial()
+		let ex = expectation(description: "Waiting for invokeSync")
+		pool.concurrent.invoke {
+			XCTAssert(serial.invokeSync { 3 } == 3)
+			serial.invoke {
+				XCTAssert(other.invokeSync { other.invokeSync { 5 } } == 5)
+				ex.fulfill()
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+	}
+	
+	func testStealing() {
+		// Jobs submitted from a worker are queued on that worker. While that worker is blocked, only stealing lets them run.
+		let pool = WorkStealingPool(workerCount: 2)
+		let blocker = DispatchSemaphore(value: 0)
+		let ex = expectation(description: "Waiting for stolen jobs")
+		let mutex = PThreadMutex()
+		var count = 0
+		pool.concurrent.invoke {
+			for _ in 0..<100 {
+				pool.concurrent.invoke {
+					let done = mutex.sync { () -> Bool in
+						count += 1
+						return count == 100
+					}
+					if done {
+						ex.fulfill()
+					}
+				}
+			}
+			blocker.wait()
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		blocker.signal()
+	}
+}
@@ -1,5 +1,9 @@
 // swift-tools-version:5.0
 import PackageDescription
+import Foundation
+
+// Per-Signal metrics are compiled in only when requested (e.g. `CWLSIGNAL_METRICS=1 swift test`) so that Debug builds of dependent packages don't pay for them.
+let metricsSettings: [SwiftSetting] = ProcessInfo.processInfo.environment["CWLSIGNAL_METRICS"] != nil ? [.define("CWLSIGNAL_METRICS")] : []
 
 let package = Package(
    name: "CwlSignal",
@@ -19,6 +23,14 @@ let package = Package(
 			name: "CwlSignal",
 			dependencies: [
 				.product(name: "CwlUtils")
+			],
+			swiftSettings: metricsSettings
+		),
+		.target(
+			name: "CwlSignalBenchmarks",
+			dependencies: [
+				.target(name: "CwlSignal"),
+				.product(name: "CwlUtils")
 			]
 		),
 		.testTarget(
@@ -26,7 +38,8 @@ let package = Package(
 			dependencies: [
 				.target(name: "CwlSignal"),
 				.product(name: "CwlPreconditionTesting")
-			]
+			],
+			swiftSettings: metricsSettings
 		)
 	]
 )
@@ -93,6 +93,21 @@ public class Signal<OutputValue>: SignalInterface {
 		return (SignalInput(signal: s, activationCount: s.activationCount), s)
 	}
 	
+	/// A version of `create` where the `Signal` queues no more than `capacity` results while its handler is busy, blocked or on a slow context, handling further results according to `policy` (see `bounded(capacity:policy:)`). Since the `SignalInput` sends directly to the bounded `Signal`, the `.reject` policy causes `send` to return `SignalSendError.queueFull` so the producer can throttle.
+	///
+	/// - Parameters:
+	///   - capacity: maximum number of non-activation results held in the queue (must be at least 1)
+	///   - policy: how a result that arrives while the queue is full is handled
+	/// - Returns: the (input, signal)
+	public static func create(capacity: Int, policy: SignalQueuePolicy) -> (input: SignalInput<OutputValue>, signal: Signal<OutputValue>) {
+		precondition(capacity > 0, "A bounded queue must have a capacity of at least 1")
+		let s = Signal<OutputValue>()
+		s.activationCount = 1
+		s.queueCapacity = capacity
+		s.queuePolicy = policy
+		return (SignalInput(signal: s, activationCount: s.activationCount), s)
+	}
+	
 	/// A version of created that creates a `SignalMultiInput` instead of a `SignalInput`.
 	///
 	/// - Returns: the (input, signal)
@@ -227,6 +242,9 @@ public class Signal<OutputValue>: SignalInterface {
 	///   - processor: the function invoked for each received `Result`
 	/// - Returns: the created `Signal`
 	public final func transform<U>(context: Exec = .direct, _ processor: @escaping (Result) -> Signal<U>.Next) -> Signal<U> {
+		if case .direct = context, let fused = fusedTransform(SignalFusionStage { processor }) {
+			return fused
+		}
 		return Signal<U>(processor: attach { (s, dw) in
 			SignalTransformer<OutputValue, U>(source: s, dw: &dw, context: context, processor)
 		}).returnToGlobalIfNeeded(context: context)
@@ -252,6 +270,9 @@ public class Signal<OutputValue>: SignalInterface {
 	///   - processor: the function invoked for each received `Result`
 	/// - Returns: the transformed output `Signal`
 	public final func transform<S, U>(initialState: S, context: Exec = .direct, _ processor: @escaping (inout S, Result) -> Signal<U>.Next) -> Signal<U> {
+		if case .direct = context, let fused = fusedTransform(SignalFusionStage.withState(initialState, processor)) {
+			return fused
+		}
 		return Signal<U>(processor: attach { (s, dw) in
 			SignalTransformerWithState<OutputValue, U, S>(source: s, initialState: initialState, dw: &dw, context: context, processor)
 		}).returnToGlobalIfNeeded(context: context)
@@ -487,6 +508,27 @@ public class Signal<OutputValue>: SignalInterface {
 		})
 	}
 	
+	/// Appends a new `SignalMulti` to this `Signal`. Like `playback()` except that only the most recent `capacity` values are retained for new listeners. Values are held in a ring buffer so discarding the oldest value is constant time.
+	///
+	/// - Parameter capacity: maximum number of values sent to a new listener on activation (must be at least 1)
+	/// - Returns: a playback `SignalMulti`
+	public final func playback(capacity: Int) -> SignalMulti<OutputValue> {
+		precondition(capacity > 0, "Playback capacity must be at least 1")
+		return SignalMulti<OutputValue>(processor: attach { (s, dw) in
+			SignalPlaybackProcessor(source: s, capacity: capacity, window: nil, dw: &dw)
+		})
+	}
+	
+	/// Appends a new `SignalMulti` to this `Signal`. Like `playback()` except that only values received within the most recent `window` are sent to new listeners. Values are held in a ring buffer so discarding the oldest value is constant time.
+	///
+	/// - Parameter window: maximum age of a value sent to a new listener on activation
+	/// - Returns: a playback `SignalMulti`
+	public final func playback(window: DispatchTimeInterval) -> SignalMulti<OutputValue> {
+		return SignalMulti<OutputValue>(processor: attach { (s, dw) in
+			SignalPlaybackProcessor(source: s, capacity: Int.max, window: window, dw: &dw)
+		})
+	}
+	
 	/// Appends a new `Signal` to this `Signal`. The new `Signal` immediately activates its antecedents and caches any values it receives until this the new `Signal` itself is activated – at which point it sends all prior values upon "activation" and subsequently reverts to passthough.
 	///
 	/// NOTE: this is intended for greedily started signals that might start emitting before the listeners connect.
@@ -499,6 +541,42 @@ public class Signal<OutputValue>: SignalInterface {
 		})
 	}
 	
+	/// Appends a new `Signal` that limits the number of results it will queue while its handler (the next stage appended to it) is busy, blocked or on a slow context.
+	///
+	/// NOTE: activation results (those queued while the `Signal` is activating) and the end of the stream are neither counted against the `capacity` nor discarded.
+	///
+	/// NOTE: results sent to the new `Signal` come from the preceeding stage of the graph, not from a producer, so they are discarded rather than refused and the `.reject` policy is not permitted. For a producer to receive `SignalSendError.queueFull` when the queue is full, use `create(capacity:policy:)`. To make an asynchronous producer wait for a slow graph instead, use `SignalInput.bounded(capacity:context:)`.
+	///
+	/// - Parameters:
+	///   - capacity: maximum number of non-activation results held in the queue (must be at least 1)
+	///   - policy: how a result that arrives while the queue is full is handled (must not be `.reject`)
+	/// - Returns: the bounded `Signal`
+	public final func bounded(capacity: Int, policy: SignalQueuePolicy) -> Signal<OutputValue> {
+		precondition(capacity > 0, "A bounded queue must have a capacity of at least 1")
+		if case .reject = policy {
+			preconditionFailure("The .reject policy requires a SignalInput sending directly to the bounded Signal. Use Signal.create(capacity:policy:) instead.")
+		}
+		let result = transform { r -> Signal<OutputValue>.Next in .single(r) }
+		
+		// The new `Signal` has no handler yet, so nothing can be queued before the bound applies
+		result.sync {
+			result.queueCapacity = capacity
+			result.queuePolicy = policy
+		}
+		return result
+	}
+	
+	/// Declares that the graph preceeding this `Signal` (this `Signal` and every `Signal` upstream of it) will not be rewired. Each of these `Signal`s with multiple predecessors (merged inputs and combiners) records the addresses of its current predecessors so that validating the sender of each result is a lookup of the sender's address, without the dynamic cast otherwise needed. `Signal`s with a single predecessor already validate with a pointer comparison and are unchanged. Since its purpose is to change `Signal`s that already exist, this changes `self` (and its antecedents) rather than appending a new `Signal`.
+	///
+	/// Freezing doesn't prevent rewiring: binding or removing an input of a frozen `Signal` (e.g. through a `SignalJunction` or `SignalMergedInput`) unfreezes that `Signal`, returning it to full validation. Activation and deactivation are unaffected.
+	///
+	/// - Returns: `self`
+	@discardableResult
+	public final func freeze() -> Signal<OutputValue> {
+		sync { freezeInternal() }
+		return self
+	}
+	
 	/// Appends a new `SignalMulti` to this `Signal`. While multiple listeners are permitted, there is no caching, activation signal or other changes inherent in this new `Signal` – newly connected listeners will receive only those values sent after they connect.
 	///
 	/// NOTE: this is intended for shared signals where new values are important but previous values are not
@@ -612,18 +690,35 @@ public class Signal<OutputValue>: SignalInterface {
 	// Protection for all mutable members on this class and any attached `signalHandler`.
 	// NOTE 1: This mutex may be shared between synchronous serially connected `Signal`s (for memory and performance efficiency).
 	// NOTE 2: It is noted that a `DispatchQueue` mutex would be preferrable since it respects libdispatch's QoS, however, it is not possible (as of Swift 4) to use `DispatchQueue` as a mutex without incurring a heap allocated closure capture so `PThreadMutex` is used instead to avoid a factor of 10 performance loss.
-	private final var mutex = os_unfair_lock()
+	// NOTE 3: The mutex is an `AdaptiveMutex` primitive (`os_unfair_lock` on Darwin, a futex-backed `pthread_mutex_t` on Linux) acquired with a brief spin, since most critical sections here (e.g. `send` and `pop`) are very short. Build with `CWLSIGNAL_NONADAPTIVE_MUTEX` defined to block without spinning.
+	private final var mutex = AdaptiveMutex.MutexPrimitive()
 	
 	fileprivate final func unbalancedLock() {
-		os_unfair_lock_lock(&mutex)
+		#if CWLSIGNAL_NONADAPTIVE_MUTEX
+			let spinCount = 0
+		#else
+			let spinCount = AdaptiveMutex.defaultSpinCount
+		#endif
+		#if CWLSIGNAL_METRICS
+			if AdaptiveMutex.tryLock(&mutex) {
+				return
+			}
+			
+			// The initial `trylock` failed, as did every attempt while spinning
+			let failedTryLocks = 1 + AdaptiveMutex.lock(&mutex, spinCount: spinCount)
+			metricsStorage.contendedLocks += 1
+			metricsStorage.failedTryLocks += failedTryLocks
+		#else
+			AdaptiveMutex.lock(&mutex, spinCount: spinCount)
+		#endif
 	}
 	
 	fileprivate final func unbalancedTryLock() -> Bool {
-		return os_unfair_lock_trylock(&mutex)
+		return AdaptiveMutex.tryLock(&mutex)
 	}
 	
 	fileprivate final func unbalancedUnlock() {
-		os_unfair_lock_unlock(&mutex)
+		AdaptiveMutex.unlock(&mutex)
 	}
 
 	fileprivate func sync<R>(execute work: () throws -> R) rethrows -> R {
@@ -633,31 +728,42 @@ public class Signal<OutputValue>: SignalInterface {
 	}
 	
 	// The graph can be disconnected and reconnected and various actions may occur outside locks, it's helpful to determine which actions are no longer relevant. The `Signal` controls this through `delivery` and `activationCount`. The `delivery` controls the basic lifecycle of a simple connected graph through 4 phases: `.disabled` (pre-connection) -> `.sychronous` (connecting) -> `.normal` (connected) -> `.disabled` (disconnected).
-	fileprivate final var delivery = SignalDelivery.disabled { didSet { handlerContextNeedsRefresh = true } }
+	fileprivate final var delivery = SignalDelivery.disabled { didSet { invalidateHandlerContextInternal() } }
 	
 	// The graph can be disconnected and reconnected and various actions may occur outside locks, it's helpful to determine which actions are no longer relevant because they are associated with a phase of a previous connection.
 	// When connected to a preceeding `SignalPredecessor`, `activationCount` is incremented on each connection and disconnection to ensure that actions associated with a previous phase of a previous connection are rejected. 
 	// When connected to a preceeding `SignalInput`, `activationCount` is incremented solely when a new `SignalInput` is attached or the current input is invalidated (joined using an `SignalJunction`).
-	fileprivate final var activationCount: Int = 0 { didSet { handlerContextNeedsRefresh = true } }
+	fileprivate final var activationCount: Int = 0 { didSet { invalidateHandlerContextInternal() } }
 	
 	// If there is a preceeding `Signal` in the graph, its `SignalProcessor` is stored in this variable. Note that `SignalPredecessor` is always an instance of `SignalProcessor`.
-	/// If Swift gains an `OrderedSet` type, it should be used here in place of this `Set` and the `sortedPreceeding` accessor, below.
-	fileprivate final var preceeding: Set<OrderedSignalPredecessor>
+	/// If Swift gains an `OrderedSet` type, it should be used for the multi-input storage of `SignalPreceedingSet` in place of its `Set` and the `sortedPreceeding` accessor, below.
+	fileprivate final var preceeding: SignalPreceedingSet
 	
 	// The destination of this `Signal`. This value is `nil` on construction.
-	fileprivate final weak var signalHandler: SignalHandler<OutputValue>? = nil { didSet { handlerContextNeedsRefresh = true } }
+	fileprivate final weak var signalHandler: SignalHandler<OutputValue>? = nil { didSet { invalidateHandlerContextInternal() } }
 	
 	fileprivate final var handlerContextNeedsRefresh = true
 	
 	// Queue of values pending dispatch (NOTE: the current `item` is not stored in the queue)
 	// Normally the queue is FIFO but when an `Signal` has multiple inputs, the "activation" from each input will be considered before any post-activation inputs.
-	private final var queue = Deque<Result>()
+	// A `SegmentedDeque` is used so that bursts grow the queue without reallocating and the memory is returned as the queue drains.
+	private final var queue = SegmentedDeque<Result>()
+	
+	// The maximum number of non-activation results in the `queue` and the handling of results that would exceed it. Set by `bounded(capacity:policy:)`.
+	private final var queueCapacity = Int.max
+	private final var queuePolicy = SignalQueuePolicy.dropOldest
 	
 	// A `holdCount` may indefinitely block the queue for one of two reasons:
 	// 1. a `SignalNext` is retained outside its handler function for asynchronous processing of an item
 	// 2. a `SignalCapture` handler has captured the activation but a `Signal` to receive the remainder is not currently connected
 	// Accordingly, the `holdCount` should only have a value in the range [0, 2]
-	private final var holdCount: UInt8 = 0
+	private final var holdCount: UInt8 = 0 {
+		didSet {
+			#if CWLSIGNAL_METRICS
+				metricsHoldChangedInternal(from: oldValue)
+			#endif
+		}
+	}
 	
 	// When a `Result` is popped from the queue and the handler is being invoked, the `itemProcessing` is set to `true`. The effect is equivalent to `holdCount`.
 	private final var itemProcessing: Bool = false
@@ -673,6 +779,26 @@ public class Signal<OutputValue>: SignalInterface {
 	// This is a cache of values that can be read outside the lock by the current owner of the `itemProcessing` flag.
 	private final var handlerContext = ItemContext<OutputValue>(context: .direct, synchronous: false, handler: { _ in }, activationCount: 0)
 	
+	// While results taken from the queue by `popBatch` are being delivered, this holds the consuming thread. Written by the consuming thread inside the mutex.
+	private final var drainThread: pthread_t? = nil
+	
+	// Set when a change made by the `drainThread` (i.e. re-entrantly from the handler) requires the remainder of the current batch to be returned to the queue. Read and written only by the `drainThread` so it may be read outside the mutex.
+	private final var drainInterrupted = false
+	
+	#if CWLSIGNAL_METRICS
+		// Counters returned by `metrics`. Protected by the mutex.
+		private final var metricsStorage = SignalMetrics()
+		
+		// Start of the current period where `holdCount > 0`
+		private final var holdStartTime: UInt64 = 0
+	#endif
+	
+	// Set when a `.direct` transformation appended to this `Signal` was fused into the preceeding transformer. This `Signal` is then detached from the graph and can never be given a handler.
+	private final var fusedIntoSuccessor = false
+	
+	// Set by `freeze` when there are two or more `preceeding`: their object addresses, so `isCurrent` can validate a predecessor without casting it to `SignalPredecessor`. Any change to `preceeding` resets this to `nil`.
+	private final var frozenPreceeding: Set<UnsafeMutableRawPointer>? = nil
+	
 	// MARK: - Signal private functions
 	
 	// Invokes `removeAllPreceedingInternal` if and only if the `forDisconnector` matches the current `preceeding.first`
@@ -705,7 +831,7 @@ public class Signal<OutputValue>: SignalInterface {
 	fileprivate func attach<R>(constructor: (Signal<OutputValue>, inout DeferredWork) -> R) -> R where R: SignalHandler<OutputValue> {
 		var dw = DeferredWork()
 		let result: R? = sync {
-			self.signalHandler == nil ? constructor(self, &dw) : nil
+			self.signalHandler == nil && !self.fusedIntoSuccessor ? constructor(self, &dw) : nil
 		}
 		dw.runWork()
 		if let r = result {
@@ -715,6 +841,28 @@ public class Signal<OutputValue>: SignalInterface {
 		}
 	}
 	
+	// If this `Signal` is the unconnected output of a `.direct` transformer, the `next` transformation stage is fused into that transformer, replacing it with a single `SignalFusedTransformer` that emits directly to a new output `Signal`. This avoids a `Signal`, its mutex and its queue per stage in long `.direct` chains (e.g. `map`, `filter`, `compactMap`).
+	// Fusion never crosses a non-`.direct` context (the stage might need to run elsewhere) or a `SignalMulti` (the output must remain available to multiple handlers).
+	// Like `predecessorsSuccessorInternal`, this acquires the upstream mutex (of the fused processor's `source`) while holding the downstream mutex (of `self`). This is the same downstream-to-upstream order used when connecting graphs (`addPreceedingInternal` invoking `outputAddedSuccessorInternal`), so fusion can't deadlock against a concurrent bind.
+	//
+	// - Parameter next: the transformation to append
+	// - Returns: the output of the fused transformer or `nil` if fusion isn't possible and a regular transformer must be attached
+	private final func fusedTransform<U>(_ next: SignalFusionStage<OutputValue, U>) -> Signal<U>? {
+		if self is SignalMulti<OutputValue> {
+			return nil
+		}
+		return sync { () -> Signal<U>? in
+			guard signalHandler == nil, !fusedIntoSuccessor, delivery.isDisabled, queue.isEmpty, queueCapacity == Int.max, newInputSignal == nil, preceeding.count == 1, let fusable = preceeding.first?.base as? SignalFusable else {
+				return nil
+			}
+			guard let fused = fusable.fusedSuccessorInternal(next) else {
+				return nil
+			}
+			fusedIntoSuccessor = true
+			return fused
+		}
+	}
+	
 	/// Avoids complications with non-reentrant 
 	///
 	/// - Parameter context: the context upon which `asyncRelativeContext` will be called
@@ -756,6 +904,7 @@ public class Signal<OutputValue>: SignalInterface {
 	//   - dw: required
 	// - Throws: any error from `outputAddedSuccessorInternal` invoked on `newPreceeding`
 	fileprivate final func addPreceedingInternal(_ newPreceeding: SignalPredecessor, param: Any?, dw: inout DeferredWork) throws {
+		frozenPreceeding = nil
 		preceedingCount += 1
 		let wrapped = newPreceeding.wrappedWithOrder(preceedingCount)
 		preceeding.insert(wrapped)
@@ -790,6 +939,7 @@ public class Signal<OutputValue>: SignalInterface {
 	//   - dw: required
 	fileprivate final func removePreceedingWithoutInterruptionInternal(_ oldPreceeding: SignalPredecessor, dw: inout DeferredWork) -> Bool {
 		if preceeding.remove(oldPreceeding.wrappedWithOrder(0)) != nil {
+			frozenPreceeding = nil
 			oldPreceeding.outputRemovedSuccessorInternal(self, dw: &dw)
 			return true
 		}
@@ -803,6 +953,7 @@ public class Signal<OutputValue>: SignalInterface {
 	//   - dw: required
 	fileprivate final func removeAllPreceedingInternal(dw: inout DeferredWork) {
 		if preceeding.count > 0 {
+			frozenPreceeding = nil
 			dw.append { [preceeding] in withExtendedLifetime(preceeding) {} }
 			
 			// Careful to use *sorted* preceeding to propagate graph changes deterministically
@@ -820,7 +971,7 @@ public class Signal<OutputValue>: SignalInterface {
 	//   - predecessor: the `SignalInput` or `SignalNext` delivering the handler
 	//   - activationCount: the activation count from the predecessor to match against internal value
 	//   - activated: whether the predecessor is already in `normal` delivery mode
-	// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled`.
+	// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
 	@discardableResult @usableFromInline
 	final func send(result: Result, predecessor: Unmanaged<AnyObject>?, activationCount: Int, activated: Bool) -> SignalSendError? {
 		unbalancedLock()
@@ -839,19 +990,28 @@ public class Signal<OutputValue>: SignalInterface {
 				assert(queue.isEmpty)
 				break
 			} else {
-				queue.append(result)
+				var discarded = Array<Result>()
+				let error = appendBoundedInternal(result, discarded: &discarded)
 				unbalancedUnlock()
-				return nil
+				
+				// Release any discarded results past the end of the lock
+				withExtendedLifetime(discarded) {}
+				return error
 			}
 		case .synchronous(let count):
 			if activated {
-				queue.append(result)
+				var discarded = Array<Result>()
+				let error = appendBoundedInternal(result, discarded: &discarded)
 				unbalancedUnlock()
-				return nil
+				
+				// Release any discarded results past the end of the lock
+				withExtendedLifetime(discarded) {}
+				return error
 			} else if count == 0, holdCount == 0, itemProcessing == false {
 				break
 			} else {
 				queue.insert(result, at: count)
+				metricsEnqueuedInternal(1)
 				delivery = .synchronous(count + 1)
 				unbalancedUnlock()
 				return nil
@@ -871,6 +1031,7 @@ public class Signal<OutputValue>: SignalInterface {
 			let hasHandler = refreshItemContextInternal(&dw)
 			if hasHandler {
 				itemProcessing = true
+				metricsDeliveredDirectInternal(1)
 			}
 			unbalancedUnlock()
 			
@@ -882,6 +1043,7 @@ public class Signal<OutputValue>: SignalInterface {
 			}
 		} else {
 			itemProcessing = true
+			metricsDeliveredDirectInternal(1)
 			unbalancedUnlock()
 		}
 		
@@ -905,6 +1067,121 @@ public class Signal<OutputValue>: SignalInterface {
 		return nil
 	}
 	
+	// A batched version of `send(result:predecessor:activationCount:activated:)`. The mutex is acquired once for the whole batch, the `predecessor` and `activationCount` are validated once and any results that can't be delivered immediately are added to the queue in a single operation. If the batch can be delivered immediately, the first result is dispatched and the remainder are drained from the queue by the same thread in the usual `pop` loop.
+	//
+	// - Parameters:
+	//   - results: the values or errors to pass to any attached handler, in order
+	//   - predecessor: the `SignalInput` or `SignalNext` delivering the handler
+	//   - activationCount: the activation count from the predecessor to match against internal value
+	//   - activated: whether the predecessor is already in `normal` delivery mode
+	// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
+	@discardableResult @usableFromInline
+	final func send(results: Array<Result>, predecessor: Unmanaged<AnyObject>?, activationCount: Int, activated: Bool) -> SignalSendError? {
+		guard let first = results.first else { return nil }
+		if results.count == 1 {
+			return send(result: first, predecessor: predecessor, activationCount: activationCount, activated: activated)
+		}
+		
+		unbalancedLock()
+		
+		guard isCurrent(predecessor, activationCount) else {
+			unbalancedUnlock()
+			
+			// Retain the results past the end of the lock
+			withExtendedLifetime(results) {}
+			return SignalSendError.disconnected
+		}
+		
+		// Set to true when the remainder of the batch must be delivered as part of the synchronous activation
+		var remainderIsSynchronous = false
+		
+		// Results removed or refused by the `queueCapacity`, released outside the lock
+		var discarded = Array<Result>()
+		
+		switch delivery {
+		case .normal:
+			if holdCount == 0 && itemProcessing == false {
+				assert(queue.isEmpty)
+				break
+			} else {
+				let error = appendBoundedInternal(contentsOf: results, discarded: &discarded)
+				unbalancedUnlock()
+				withExtendedLifetime(discarded) {}
+				return error
+			}
+		case .synchronous(let count):
+			if activated {
+				let error = appendBoundedInternal(contentsOf: results, discarded: &discarded)
+				unbalancedUnlock()
+				withExtendedLifetime(discarded) {}
+				return error
+			} else if count == 0, holdCount == 0, itemProcessing == false {
+				// NOTE: `delivery` must be changed before `refreshItemContextInternal`, below, since changing it invalidates the `handlerContext`
+				remainderIsSynchronous = true
+				delivery = .synchronous(results.count - 1)
+			} else {
+				queue.insert(contentsOf: results, at: count)
+				metricsEnqueuedInternal(results.count)
+				delivery = .synchronous(count + results.count)
+				unbalancedUnlock()
+				return nil
+			}
+		case .disabled:
+			unbalancedUnlock()
+			
+			// Retain the results past the end of the lock
+			withExtendedLifetime(results) {}
+			return SignalSendError.inactive
+		}
+		
+		assert(holdCount == 0 && itemProcessing == false)
+		
+		var error: SignalSendError? = nil
+		if handlerContextNeedsRefresh {
+			var dw = DeferredWork()
+			let hasHandler = refreshItemContextInternal(&dw)
+			if hasHandler {
+				itemProcessing = true
+				metricsDeliveredDirectInternal(1)
+				if remainderIsSynchronous {
+					queue.insert(contentsOf: results.dropFirst(), at: 0)
+					metricsEnqueuedInternal(results.count - 1)
+				} else {
+					error = appendBoundedInternal(contentsOf: results.dropFirst(), discarded: &discarded)
+				}
+			} else if remainderIsSynchronous {
+				delivery = .synchronous(0)
+			}
+			unbalancedUnlock()
+			
+			// See the equivalent comment in `send(result:predecessor:activationCount:activated:)`
+			dw.runWork()
+			
+			if !hasHandler {
+				withExtendedLifetime(results) {}
+				return SignalSendError.inactive
+			}
+		} else {
+			itemProcessing = true
+			metricsDeliveredDirectInternal(1)
+			if remainderIsSynchronous {
+				queue.insert(contentsOf: results.dropFirst(), at: 0)
+				metricsEnqueuedInternal(results.count - 1)
+			} else {
+				error = appendBoundedInternal(contentsOf: results.dropFirst(), discarded: &discarded)
+			}
+			unbalancedUnlock()
+		}
+		withExtendedLifetime(discarded) {}
+		
+		#if DEBUG_LOGGING
+			print("\(type(of: self)): \(self.count) emitted \(results.count) results, starting with \(first))")
+		#endif
+		
+		dispatch(first)
+		return error
+	}
+	
 	// A secondary send function used to push values and possibly and end-of-stream error onto the `newInputSignal`. The push is not handled immediately but is deferred until the `DeferredWork` runs. Since values are *always* queued, this is less efficient than `send` but it avoids re-entrancy into self if the `newInputSignal` immediately tries to send values back to us.
 	//
 	// - Parameters:
@@ -937,18 +1214,114 @@ public class Signal<OutputValue>: SignalInterface {
 		}
 		
 		if !activated, case .synchronous(let count) = delivery {
+			// Activation values are never subject to the `queueCapacity`
 			assert(count == 0)
 			delivery = .synchronous(values.count + (end != nil ? 1 : 0))
+			queue.append(contentsOf: values.lazy.map { Result.success($0) })
+			if let e = end {
+				queue.append(.failure(e))
+			}
+			metricsEnqueuedInternal(values.count + (end != nil ? 1 : 0))
+		} else {
+			var discarded = Array<Result>()
+			for v in values {
+				_ = appendBoundedInternal(.success(v), discarded: &discarded)
+			}
+			if let e = end {
+				_ = appendBoundedInternal(.failure(e), discarded: &discarded)
+			}
+			if !discarded.isEmpty {
+				dw.append { withExtendedLifetime(discarded) {} }
+			}
 		}
 		
-		for v in values {
-			queue.append(.success(v))
+		resumeIfPossibleInternal(dw: &dw)
+	}
+	
+	// Appends `result` to the queue, applying the `queueCapacity` and `queuePolicy`. Results in the synchronous activation range (the first `count` results while `delivery` is `.synchronous(count)`) are not counted or removed and an end is always queued, so activation and end-of-stream are unaffected by the bound.
+	//
+	// - Parameters:
+	//   - result: appended to the queue
+	//   - discarded: receives any result removed from the queue or refused, so it can be released outside the mutex
+	// - Returns: `SignalSendError.queueFull` if `result` was refused by the `.reject` policy, otherwise `nil`
+	@inline(__always)
+	private final func appendBoundedInternal(_ result: Result, discarded: inout Array<Result>) -> SignalSendError? {
+		let activationRange: Int
+		if case .synchronous(let count) = delivery {
+			activationRange = count
+		} else {
+			activationRange = 0
+		}
+		if queue.count &- activationRange < queueCapacity {
+			queue.append(result)
+			metricsEnqueuedInternal(1)
+			return nil
 		}
-		if let e = end {
-			queue.append(.failure(e))
+		return overflowInternal(result, activationRange: activationRange, discarded: &discarded)
+	}
+	
+	// A batched version of `appendBoundedInternal(_:discarded:)`
+	//
+	// - Parameters:
+	//   - results: appended to the queue, in order
+	//   - discarded: receives any result removed from the queue or refused, so it can be released outside the mutex
+	// - Returns: `SignalSendError.queueFull` if any of `results` was refused by the `.reject` policy, otherwise `nil`
+	private final func appendBoundedInternal<C: Collection>(contentsOf results: C, discarded: inout Array<Result>) -> SignalSendError? where C.Iterator.Element == Result {
+		if queueCapacity == Int.max {
+			queue.append(contentsOf: results)
+			metricsEnqueuedInternal(results.count)
+			return nil
+		}
+		var error: SignalSendError? = nil
+		for r in results {
+			if let e = appendBoundedInternal(r, discarded: &discarded) {
+				error = e
+			}
+		}
+		return error
+	}
+	
+	// Applies the `queuePolicy` when `result` arrives and the queue is already at `queueCapacity`.
+	//
+	// - Parameters:
+	//   - result: the arriving result
+	//   - activationRange: number of results at the front of the queue that are part of the synchronous activation
+	//   - discarded: receives any result removed from the queue or refused
+	// - Returns: `SignalSendError.queueFull` if `result` was refused by the `.reject` policy, otherwise `nil`
+	private final func overflowInternal(_ result: Result, activationRange: Int, discarded: inout Array<Result>) -> SignalSendError? {
+		// An end is always queued (it may exceed the capacity by one) and a value arriving after a queued end can be ignored
+		if case .failure = result {
+			queue.append(result)
+			metricsEnqueuedInternal(1)
+			return nil
+		} else if case .failure? = queue.last {
+			discarded.append(result)
+			metricsDroppedInternal(1)
+			return nil
 		}
 		
-		resumeIfPossibleInternal(dw: &dw)
+		switch queuePolicy {
+		case .dropOldest:
+			discarded.append(queue[activationRange])
+			if activationRange == 0 {
+				_ = queue.removeFirst()
+			} else {
+				queue.replaceSubrange(activationRange..<(activationRange + 1), with: EmptyCollection())
+			}
+			queue.append(result)
+			metricsEnqueuedInternal(1)
+		case .dropNewest:
+			discarded.append(result)
+		case .coalesceLatest:
+			discarded.append(queue[queue.count - 1])
+			queue[queue.count - 1] = result
+		case .reject:
+			discarded.append(result)
+			metricsDroppedInternal(1)
+			return SignalSendError.queueFull
+		}
+		metricsDroppedInternal(1)
+		return nil
 	}
 	
 	// Used in SignalCapture.handleSynchronousToNormalInternal to handle a situation where a deactivation and reactivation occurs *while* `itemProcessing` so the next capture is in the queue instead of being captured. This function extracts the queued value for capture before transition to normal.
@@ -956,14 +1329,18 @@ public class Signal<OutputValue>: SignalInterface {
 	// - Returns: the queued items under the synchronous count.
 	fileprivate final func pullQueuedSynchronousInternal() -> (values: Array<OutputValue>, end: SignalEnd?) {
 		if case .synchronous(let count) = delivery, count > 0 {
+			var results = Array<Result>()
+			queue.drain(into: &results, maxCount: count)
 			var values = Array<OutputValue>()
+			values.reserveCapacity(count)
 			var end: SignalEnd? = nil
-			for _ in 0..<count {
-				switch queue.removeFirst() {
+			for r in results {
+				switch r {
 				case .success(let v): values.append(v)
 				case .failure(let e): end = e
 				}
 			}
+			metricsDequeuedInternal(count)
 			delivery = .synchronous(0)
 			return (values, end)
 		}
@@ -1130,9 +1507,9 @@ public class Signal<OutputValue>: SignalInterface {
 		activationCount = activationCount &+ 1
 		
 		if andInvalidateAllPrevious {
-			let oldItems = Array<Result>(queue)
+			var oldItems = Array<Result>()
+			queue.drain(into: &oldItems)
 			dw.append { withExtendedLifetime(oldItems) {} }
-			queue.removeAll()
 			holdCount = 0
 		} else {
 			assert(holdCount == 0)
@@ -1175,10 +1552,23 @@ public class Signal<OutputValue>: SignalInterface {
 			return predecessor == nil
 		}
 		
+		if let frozen = frozenPreceeding {
+			guard let p = predecessor?.toOpaque() else { return false }
+			return frozen.contains(p)
+		}
 		guard let p = predecessor?.takeUnretainedValue() as? SignalPredecessor else { return false }
 		return preceeding.contains(p.wrappedWithOrder(0))
 	}
 	
+	// Records the current `preceeding` in `frozenPreceeding` and freezes each predecessor's own source `Signal`. Like `predecessorsSuccessorInternal`, this acquires each upstream mutex while holding the downstream mutex.
+	fileprivate final func freezeInternal() {
+		assert(unbalancedTryLock() == false)
+		frozenPreceeding = preceeding.count > 1 ? Set(preceeding.map { Unmanaged<AnyObject>.passUnretained($0.base).toOpaque() }) : nil
+		for p in preceeding {
+			p.base.freezePredecessorsInternal()
+		}
+	}
+	
 	// The `handlerContext` holds information uniquely used by the currently processing item so it can be read outside the  This may only be called immediately before calling `blockInternal` to start a processing item (e.g. from `send` or `resume`.
 	//
 	// - Parameter dw: required
@@ -1262,10 +1652,76 @@ public class Signal<OutputValue>: SignalInterface {
 				}
 				self.unbalancedUnlock()
 				
-				for r in sequence(first: result, next: { _ in self.pop() }) {
-					self.invokeHandler(r)
-				}
+				self.invokeHandler(result)
+				self.drainBatches()
+			}
+		}
+	}
+	
+	// Used in place of repeated calls to `pop` when the handler is invoked asynchronously. Senders on other threads contend for the mutex with the consumer, so results are moved out of the queue in batches to reduce the number of times the consumer must acquire the mutex.
+	private final func drainBatches() {
+		var batch = Array<Result>()
+		while popBatch(into: &batch) {
+			if drainThread == nil {
+				invokeHandler(batch[0])
+				continue
+			}
+			var processed = 0
+			while processed < batch.count && !drainInterrupted {
+				invokeHandler(batch[processed])
+				processed += 1
 			}
+			endBatch(batch, processed: processed)
+		}
+	}
+	
+	// Fills `batch` with the next results for processing. When delivery is `.normal`, the queue is not held and the handler context is current, up to 64 results are moved in a single acquisition of the mutex and `drainThread` is set. Otherwise, this defers to `pop`.
+	//
+	// - Parameter batch: emptied and then filled with the results to process
+	// - Returns: true if `batch` contains results, false if processing is complete
+	private final func popBatch(into batch: inout Array<Result>) -> Bool {
+		batch.removeAll(keepingCapacity: true)
+		unbalancedLock()
+		assert(itemProcessing == true)
+		
+		guard case .normal = delivery, !handlerContextNeedsRefresh, holdCount == 0, queue.count > 1 else {
+			unbalancedUnlock()
+			if let r = pop() {
+				batch.append(r)
+				return true
+			}
+			return false
+		}
+		
+		queue.drain(into: &batch, maxCount: 64)
+		metricsDequeuedInternal(batch.count)
+		drainThread = pthread_self()
+		unbalancedUnlock()
+		return true
+	}
+	
+	// Completes a batch started by `popBatch`. If the batch was interrupted, the unprocessed remainder is returned to the front of the queue (where the next `pop` will consider it under the new conditions).
+	//
+	// - Parameters:
+	//   - batch: the batch returned from `popBatch`
+	//   - processed: the number of results from `batch` already passed to the handler
+	private final func endBatch(_ batch: Array<Result>, processed: Int) {
+		unbalancedLock()
+		if processed < batch.count {
+			queue.insert(contentsOf: batch[processed...], at: 0)
+			metricsDequeuedInternal(processed - batch.count)
+		}
+		drainThread = nil
+		drainInterrupted = false
+		unbalancedUnlock()
+	}
+	
+	// Invoked inside the mutex when `delivery`, `activationCount` or the handler changes, so `pop` returns no further results until the `handlerContext` is refreshed. If the change is made by the consuming thread while a batch is outstanding (e.g. the handler cancels its own output), the batch is interrupted before its next result.
+	// Changes from other threads are not checked per result (doing so would take the mutex for every result): they are observed at the end of the batch, so a handler being replaced or deactivated from another thread may receive up to 63 further results, as though the change had occurred slightly later.
+	fileprivate final func invalidateHandlerContextInternal() {
+		handlerContextNeedsRefresh = true
+		if let t = drainThread, pthread_equal(t, pthread_self()) != 0 {
+			drainInterrupted = true
 		}
 	}
 	
@@ -1289,6 +1745,7 @@ public class Signal<OutputValue>: SignalInterface {
 				fallthrough
 			default:
 				let result = queue.removeFirst()
+				metricsDequeuedInternal(1)
 				unbalancedUnlock()
 				return result
 			}
@@ -1315,6 +1772,55 @@ public class Signal<OutputValue>: SignalInterface {
 			unbalancedUnlock()
 		}
 	}
+	
+	// MARK: - Signal metrics
+	
+	// The following functions update `metricsStorage` when built with `CWLSIGNAL_METRICS` and are empty (and inlined away) otherwise. All must be invoked inside the mutex.
+	
+	// Records `count` results added to the queue
+	@inline(__always)
+	private final func metricsEnqueuedInternal(_ count: Int) {
+		#if CWLSIGNAL_METRICS
+			metricsStorage.queued += count
+			metricsStorage.queueHighWaterMark = Swift.max(metricsStorage.queueHighWaterMark, queue.count)
+		#endif
+	}
+	
+	// Records `count` results removed from the queue or refused by the `queuePolicy`
+	@inline(__always)
+	private final func metricsDroppedInternal(_ count: Int) {
+		#if CWLSIGNAL_METRICS
+			metricsStorage.dropped += count
+		#endif
+	}
+	
+	// Records `count` results passed to the handler without being queued
+	@inline(__always)
+	private final func metricsDeliveredDirectInternal(_ count: Int) {
+		#if CWLSIGNAL_METRICS
+			metricsStorage.direct += count
+			metricsStorage.delivered += count
+		#endif
+	}
+	
+	// Records `count` results removed from the queue for delivery to the handler (negative when unprocessed results are returned to the queue)
+	@inline(__always)
+	private final func metricsDequeuedInternal(_ count: Int) {
+		#if CWLSIGNAL_METRICS
+			metricsStorage.delivered += count
+		#endif
+	}
+	
+	#if CWLSIGNAL_METRICS
+		// Accumulates the time spent with `holdCount > 0`
+		private final func metricsHoldChangedInternal(from oldValue: UInt8) {
+			if oldValue == 0 && holdCount > 0 {
+				holdStartTime = DispatchTime.now().uptimeNanoseconds
+			} else if oldValue > 0 && holdCount == 0 {
+				metricsStorage.heldNanoseconds += DispatchTime.now().uptimeNanoseconds - holdStartTime
+			}
+		}
+	#endif
 }
 
 /// `SignalMulti<OutputValue>` is the only subclass of `Signal<OutputValue>`. It represents a `Signal<OutputValue>` that allows attaching multiple listeners (a normal `Signal<OutputValue>` is "single owner" and will immediately close any subsequent listeners after the first with a `SignalBindError.duplicate` error).
@@ -1356,13 +1862,23 @@ public class SignalInput<InputValue>: Lifetime, SignalInputInterface {
 	/// The primary signal sending function
 	///
 	/// - Parameter result: the value or error to send, composed as a `Result`
-	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled`.
+	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
 	@discardableResult @inlinable
 	public func send(result: Result<InputValue, SignalEnd>) -> SignalSendError? {
 		guard let s = signal else { return SignalSendError.disconnected }
 		return s.send(result: result, predecessor: nil, activationCount: activationCount, activated: true)
 	}
 	
+	/// A batched version of `send(result:)`. The destination `Signal` is locked once for the whole batch and any results that can't be delivered immediately are queued in a single operation, so this is significantly faster than repeated calls to `send(result:)` when sending bursts of values.
+	///
+	/// - Parameter results: the values or errors to send, in order, composed as `Result`s
+	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
+	@discardableResult @inlinable
+	public func send(contentsOf results: Array<Result<InputValue, SignalEnd>>) -> SignalSendError? {
+		guard let s = signal else { return SignalSendError.disconnected }
+		return s.send(results: results, predecessor: nil, activationCount: activationCount, activated: true)
+	}
+	
 	/// The purpose for this method is to obtain a true `SignalInput` (instead of a `SignalMultiInput` or `SignalMergedInput`. A true `SignalInput` is faster for multiple send operations and is needed internally by the `bind` methods.
 	/// The base `SignalInput` implementation returns `self`.
 	public func singleInput() -> SignalInput<InputValue> {
@@ -1389,7 +1905,10 @@ public class SignalInput<InputValue>: Lifetime, SignalInputInterface {
 public class SignalHandler<OutputValue> {
 	fileprivate final let source: Signal<OutputValue>
 	fileprivate final let context: Exec
-	fileprivate final var handler: (Result<OutputValue, SignalEnd>) -> Void { didSet { source.handlerContextNeedsRefresh = true } }
+	fileprivate final var handler: (Result<OutputValue, SignalEnd>) -> Void { didSet { source.invalidateHandlerContextInternal() } }
+	
+	// Set (inside the `source` mutex) when `fusedSuccessor` replaces this handler with a `SignalFusedTransformer`. The `source` then belongs to the replacement so this handler must not change it on `deinit`.
+	fileprivate final var replacedByFusion = false
 	
 	// Base constructor sets the `source`, `context` and `handler` and implicitly activates if required.
 	//
@@ -1450,6 +1969,7 @@ public class SignalHandler<OutputValue> {
 	deinit {
 		var dw = DeferredWork()
 		sync {
+			guard !replacedByFusion else { return }
 			if !source.delivery.isDisabled {
 				source.changeDeliveryInternal(newDelivery: .disabled, dw: &dw)
 			}
@@ -1545,6 +2065,104 @@ fileprivate struct OrderedSignalPredecessor: Hashable {
 	}
 }
 
+// The predecessors of a `Signal`. Almost every `Signal` has zero or one predecessor so that case is stored inline, avoiding a `Set` allocation per node. A `Set` is used only while there are two or more predecessors (merged inputs and combiners).
+fileprivate struct SignalPreceedingSet: Sequence, ExpressibleByArrayLiteral {
+	private enum Storage {
+		case none
+		case single(OrderedSignalPredecessor)
+		case multiple(Set<OrderedSignalPredecessor>)
+	}
+	
+	private var storage: Storage
+	
+	init(arrayLiteral elements: OrderedSignalPredecessor...) {
+		switch elements.count {
+		case 0: storage = .none
+		case 1: storage = .single(elements[0])
+		default: storage = .multiple(Set(elements))
+		}
+	}
+	
+	var count: Int {
+		switch storage {
+		case .none: return 0
+		case .single: return 1
+		case .multiple(let set): return set.count
+		}
+	}
+	
+	var underestimatedCount: Int {
+		return count
+	}
+	
+	var first: OrderedSignalPredecessor? {
+		switch storage {
+		case .none: return nil
+		case .single(let p): return p
+		case .multiple(let set): return set.first
+		}
+	}
+	
+	func contains(_ member: OrderedSignalPredecessor) -> Bool {
+		switch storage {
+		case .none: return false
+		case .single(let p): return p == member
+		case .multiple(let set): return set.contains(member)
+		}
+	}
+	
+	// As with `Set.insert`, an existing equal member is retained (along with its order).
+	mutating func insert(_ member: OrderedSignalPredecessor) {
+		switch storage {
+		case .none: storage = .single(member)
+		case .single(let p) where p == member: break
+		case .single(let p): storage = .multiple([p, member])
+		case .multiple(var set):
+			// Clear `storage` so that `set` is uniquely referenced during mutation
+			storage = .none
+			set.insert(member)
+			storage = .multiple(set)
+		}
+	}
+	
+	@discardableResult
+	mutating func remove(_ member: OrderedSignalPredecessor) -> OrderedSignalPredecessor? {
+		switch storage {
+		case .none: return nil
+		case .single(let p) where p == member:
+			storage = .none
+			return p
+		case .single: return nil
+		case .multiple(var set):
+			storage = .none
+			let removed = set.remove(member)
+			storage = set.count == 1 ? .single(set.first!) : .multiple(set)
+			return removed
+		}
+	}
+	
+	func makeIterator() -> Iterator {
+		switch storage {
+		case .none: return Iterator(single: nil, multiple: nil)
+		case .single(let p): return Iterator(single: p, multiple: nil)
+		case .multiple(let set): return Iterator(single: nil, multiple: set.makeIterator())
+		}
+	}
+	
+	struct Iterator: IteratorProtocol {
+		var single: OrderedSignalPredecessor?
+		var multiple: Set<OrderedSignalPredecessor>.Iterator?
+		
+		mutating func next() -> OrderedSignalPredecessor? {
+			if let s = single {
+				single = nil
+				return s
+			}
+			return multiple?.next()
+		}
+	}
+}
+
 // A protocol used for communicating from successor `Signal`s to predecessor `SignalProcessor`s in the signal graph.
 // Used for connectivity and activation.
 fileprivate protocol SignalPredecessor: class {
@@ -1554,6 +2172,7 @@ fileprivate protocol SignalPredecessor: class {
 	func outputAddedSuccessorInternal(_ successor: AnyObject, param: Any?, activationCount: Int?, dw: inout DeferredWork) throws
 	func outputRemovedSuccessorInternal(_ successor: AnyObject, dw: inout DeferredWork)
 	func predecessorsSuccessorInternal(loopCheck: AnyObject) -> Bool
+	func freezePredecessorsInternal()
 	func outputSignals<U>(ofType: U.Type) -> [Signal<U>]
 	var loopCheckValue: AnyObject { get }
 	func wrappedWithOrder(_ order: Int) -> OrderedSignalPredecessor
@@ -1627,6 +2246,13 @@ public class SignalProcessor<OutputValue, U>: SignalHandler<OutputValue>, Signal
 		return result
 	}
 	
+	// Freezes the `Signal` that feeds this processor (and, recursively, its predecessors).
+	func freezePredecessorsInternal() {
+		runSuccesorAction {
+			source.freezeInternal()
+		}
+	}
+	
 	/// Returns the list of outputs, assuming they match the provided type. This method is used when attempting to remove a SignalMulti from the list of inputs to a SignalInputMulti since the whole list of outputs may need to be searched to find one that's actually connected to the SignalInputMulti.
 	///
 	/// - Parameter ofType: specifies the input type of the SignalInputMulti (it will always match but we follow the type system, rather than force matching.
@@ -2026,6 +2652,143 @@ fileprivate final class SignalMultiProcessor<OutputValue>: SignalProcessor<Outpu
 	}
 }
 
+// Implementation of a processor for `playback(capacity:)` and `playback(window:)`. This behaves like the `playback()` configuration of `SignalMultiProcessor` but the activation values are limited by count or age and are held in a `Deque` so that discarding the oldest value is O(1). An `Array` snapshot of the activation values is created on demand and shared by every output activated before the next change, rather than rebuilt for each.
+fileprivate final class SignalPlaybackProcessor<OutputValue>: SignalProcessor<OutputValue, OutputValue> {
+	let capacity: Int
+	let window: DispatchTimeInterval?
+	var values = Deque<OutputValue>()
+	var timestamps = Deque<DispatchTime>()
+	var preclosed: SignalEnd? = nil
+	var snapshot: Array<OutputValue>? = nil
+	
+	// - Parameters:
+	//   - source: the predecessor signal
+	//   - capacity: maximum number of activation values
+	//   - window: maximum age of activation values (if any)
+	//   - dw: required
+	init(source: Signal<OutputValue>, capacity: Int, window: DispatchTimeInterval?, dw: inout DeferredWork) {
+		self.capacity = capacity
+		self.window = window
+		super.init(source: source, dw: &dw, context: .direct)
+	}
+	
+	// Always active until closed
+	fileprivate override var activeWithoutOutputsInternal: Bool {
+		assert(source.unbalancedTryLock() == false)
+		return preclosed == nil
+	}
+	
+	// Playback can handle multiple outputs
+	fileprivate override var multipleOutputsPermitted: Bool {
+		return true
+	}
+	
+	// Removes values beyond the `capacity` or older than the `window`.
+	//
+	// - Parameter now: the current time (used only when there is a `window`)
+	// - Returns: the removed values so they can be released outside the mutex
+	private final func evictInternal(now: DispatchTime) -> Array<OutputValue> {
+		var expired = Array<OutputValue>()
+		while values.count > capacity {
+			expired.append(values.removeFirst())
+			if window != nil {
+				_ = timestamps.removeFirst()
+			}
+		}
+		if let w = window {
+			while let t = timestamps.first, t + w < now {
+				_ = timestamps.removeFirst()
+				expired.append(values.removeFirst())
+			}
+		}
+		if !expired.isEmpty {
+			snapshot = nil
+		}
+		return expired
+	}
+	
+	// Applies an incoming result to the activation values and end.
+	//
+	// - Parameter result: the incoming result
+	// - Returns: any values removed from the activation values, so they can be released outside the mutex
+	private final func updateInternal(_ result: Result<OutputValue, SignalEnd>) -> Array<OutputValue> {
+		let now = window != nil ? DispatchTime.now() : DispatchTime(uptimeNanoseconds: 0)
+		switch result {
+		case .success(let v):
+			values.append(v)
+			if window != nil {
+				timestamps.append(now)
+			}
+		case .failure(let e):
+			preclosed = e
+		}
+		snapshot = nil
+		return evictInternal(now: now)
+	}
+	
+	// Any values or errors are sent on activation.
+	//
+	// - Parameters:
+	//   - index: identifies the output
+	//   - dw: required
+	fileprivate final override func sendActivationToOutputInternal(index: Int, dw: inout DeferredWork) {
+		if window != nil {
+			let expired = evictInternal(now: DispatchTime.now())
+			if !expired.isEmpty {
+				dw.append { withExtendedLifetime(expired) {} }
+			}
+		}
+		guard !values.isEmpty || preclosed != nil else { return }
+		
+		let activationValues = snapshot ?? Array(values)
+		snapshot = activationValues
+		
+		// Push as *not* activated (i.e. this is the activation)
+		outputs[index].destination.value?.pushInternal(values: activationValues, end: preclosed, activated: false, dw: &dw)
+	}
+	
+	// Prior to activation, values are only cached
+	// - Returns: a function to use as the handler prior to activation
+	fileprivate override func initialHandlerInternal() -> (Result<OutputValue, SignalEnd>) -> Void {
+		assert(source.unbalancedTryLock() == false)
+		return { [weak self] r in
+			guard let self = self else { return }
+			let expired = self.updateInternal(r)
+			withExtendedLifetime(expired) {}
+		}
+	}
+	
+	// On result, update the activation values and send to all outputs.
+	// - Returns: a function to use as the handler after activation
+	fileprivate override func nextHandlerInternal() -> (Result<OutputValue, SignalEnd>) -> Void {
+		assert(source.unbalancedTryLock() == false)
+		
+		let activated = source.delivery.isNormal
+		
+		// NOTE: as with `SignalMultiProcessor`, the outputs are read immediately after updating the activation values so any output sent the old activation values receives this new value
+		return { [weak self] r in
+			guard let self = self else { return }
+			
+			var expired = Array<OutputValue>()
+			var outs: OutputsArray = []
+			self.sync {
+				expired = self.updateInternal(r)
+				outs = self.outputs
+			}
+			
+			// Make sure any expired content is released *outside* the mutex
+			withExtendedLifetime(expired) {}
+			
+			let predecessor: Unmanaged<AnyObject>? = Unmanaged.passUnretained(self)
+			for o in outs {
+				if let d = o.destination.value, let ac = o.activationCount {
+					d.send(result: r, predecessor: predecessor, activationCount: ac, activated: activated)
+				}
+			}
+		}
+	}
+}
+
 // Implementation of a processor that combines SignalTransformerWithState and SignalMultiProcessor functionality into a single processor (avoiding the need for a clumsy state sharing arrangement if the two are separate).
 fileprivate final class SignalReducer<OutputValue, State>: SignalProcessor<OutputValue, State> {
 	typealias Initializer = (_ message: Result<OutputValue, SignalEnd>) -> Result<State?, SignalEnd>
@@ -2216,7 +2979,7 @@ fileprivate final class SignalCacheUntilActive<OutputValue>: SignalProcessor<Out
 }
 
 // A transformer applies a user transformation to any signal. It's the typical "between two `Signal`s" handler.
-fileprivate final class SignalTransformer<OutputValue, U>: SignalProcessor<OutputValue, U> {
+fileprivate final class SignalTransformer<OutputValue, U>: SignalProcessor<OutputValue, U>, SignalFusable {
 	typealias UserProcessorType = (Result<OutputValue, SignalEnd>) -> Signal<U>.Next
 	let userProcessor: UserProcessorType
 	
@@ -2257,6 +3020,11 @@ fileprivate final class SignalTransformer<OutputValue, U>: SignalProcessor<Outpu
 			}
 		}
 	}
+	
+	// Implementation of `SignalFusable`
+	func fusedSuccessorInternal<V, W>(_ next: SignalFusionStage<V, W>) -> Signal<W>? {
+		return fusedSuccessor(of: self, stage: SignalFusionStage { [userProcessor] in userProcessor }, next: next)
+	}
 }
 
 // A transformer applies a user transformation to any signal. It's the typical "between two `Signal`s" handler.
@@ -2321,7 +3089,7 @@ fileprivate final class SignalActivationTransformer<OutputValue, U>: SignalProce
 }
 
 /// Same as `SignalTransformer` plus a `state` value that is passed `inout` to the handler each time so state can be safely retained between invocations. This `state` value is reset to its `initialState` if the signal graph is deactivated.
-fileprivate final class SignalTransformerWithState<OutputValue, U, S>: SignalProcessor<OutputValue, U> {
+fileprivate final class SignalTransformerWithState<OutputValue, U, S>: SignalProcessor<OutputValue, U>, SignalFusable {
 	typealias UserProcessorType = (inout S, Result<OutputValue, SignalEnd>) -> Signal<U>.Next
 	let userProcessor: UserProcessorType
 	let initialState: S
@@ -2369,6 +3137,150 @@ fileprivate final class SignalTransformerWithState<OutputValue, U, S>: SignalPro
 			}
 		}
 	}
+	
+	// Implementation of `SignalFusable`
+	func fusedSuccessorInternal<V, W>(_ next: SignalFusionStage<V, W>) -> Signal<W>? {
+		return fusedSuccessor(of: self, stage: SignalFusionStage.withState(initialState, userProcessor), next: next)
+	}
+}
+
+// A `.direct` transformation stage, as a factory so that each handler rebuild gets fresh state. Stages are concatenated by `appending` when `Signal.transform` fuses adjacent `.direct` transformers.
+fileprivate final class SignalFusionStage<InputValue, OutputValue> {
+	typealias Processor = (Result<InputValue, SignalEnd>) -> Signal<OutputValue>.Next
+	let makeProcessor: () -> Processor
+	
+	init(_ makeProcessor: @escaping () -> Processor) {
+		self.makeProcessor = makeProcessor
+	}
+	
+	// A stage for a stateful transformation. The `state` is reset to `initialState` each time the processor is made.
+	static func withState<S>(_ initialState: S, _ processor: @escaping (inout S, Result<InputValue, SignalEnd>) -> Signal<OutputValue>.Next) -> SignalFusionStage<InputValue, OutputValue> {
+		return SignalFusionStage {
+			var state = initialState
+			return { r in processor(&state, r) }
+		}
+	}
+	
+	// Concatenates `next` after this stage. An end emitted by this stage is passed to `next` but any subsequent output from this stage is discarded, matching the behavior of the intermediate `Signal` that fusion removes.
+	//
+	// - Parameter next: the stage that processes the output of this stage
+	// - Returns: the combined stage
+	func appending<U>(_ next: SignalFusionStage<OutputValue, U>) -> SignalFusionStage<InputValue, U> {
+		let makeFirst = makeProcessor
+		let makeSecond = next.makeProcessor
+		return SignalFusionStage<InputValue, U> {
+			let first = makeFirst()
+			let second = makeSecond()
+			var ended = false
+			return { r in
+				if ended {
+					return .none
+				}
+				switch first(r) {
+				case .none: return .none
+				case .single(let intermediate):
+					if case .failure = intermediate {
+						ended = true
+					}
+					return second(intermediate)
+				case .array(let a):
+					var results = Array<Result<U, SignalEnd>>()
+					loop: for intermediate in a {
+						switch second(intermediate) {
+						case .none: break
+						case .single(let o): results.append(o)
+						case .array(let o): results.append(contentsOf: o)
+						}
+						if case .failure = intermediate {
+							ended = true
+							break loop
+						}
+					}
+					switch results.count {
+					case 0: return .none
+					case 1: return .single(results[0])
+					default: return .array(results)
+					}
+				}
+			}
+		}
+	}
+}
+
+// Implemented by processors that can absorb a subsequent `.direct` transformation stage (see `Signal.fusedTransform`).
+fileprivate protocol SignalFusable: class {
+	// Must be invoked inside the mutex of this processor's output `Signal`. Acquires the mutex of this processor's `source` (downstream-to-upstream order, as for `predecessorsSuccessorInternal`).
+	//
+	// - Parameter next: the transformation stage to fuse after this processor
+	// - Returns: the new output `Signal` for the fused processor or `nil` if this processor can't be fused
+	func fusedSuccessorInternal<V, W>(_ next: SignalFusionStage<V, W>) -> Signal<W>?
+}
+
+// Common implementation of `SignalFusable`. Replaces `processor` as the handler of its `source` with a `SignalFusedTransformer` that runs `stage` followed by `next`.
+//
+// - Parameters:
+//   - processor: the processor to replace. Must have a `.direct` context and a single, inactive output.
+//   - stage: the transformation performed by `processor`
+//   - next: the transformation to append
+// - Returns: the output `Signal` of the fused processor or `nil` if fusion isn't possible
+fileprivate func fusedSuccessor<T, U, V, W>(of processor: SignalProcessor<T, U>, stage: @autoclosure () -> SignalFusionStage<T, U>, next: SignalFusionStage<V, W>) -> Signal<W>? {
+	guard case .direct = processor.context, let n = next as? SignalFusionStage<U, W> else { return nil }
+	var dw = DeferredWork()
+	let fused = processor.sync { () -> SignalFusedTransformer<T, W>? in
+		guard processor.source.signalHandler === processor, processor.source.delivery.isDisabled, processor.outputs.count == 1 else { return nil }
+		processor.replacedByFusion = true
+		processor.source.signalHandler = nil
+		return SignalFusedTransformer<T, W>(source: processor.source, dw: &dw, stage: stage().appending(n))
+	}
+	dw.runWork()
+	return fused.map { Signal<W>(processor: $0) }
+}
+
+// A `.direct` transformer that runs a sequence of fused transformation stages, in place of a chain of `SignalTransformer` or `SignalTransformerWithState` and their intermediate `Signal`s.
+fileprivate final class SignalFusedTransformer<OutputValue, U>: SignalProcessor<OutputValue, U>, SignalFusable {
+	let stage: SignalFusionStage<OutputValue, U>
+	
+	// Constructs a `SignalFusedTransformer`
+	//
+	// - Parameters:
+	//   - source: the predecessor signal
+	//   - dw: required
+	//   - stage: the fused transformation stages
+	init(source: Signal<OutputValue>, dw: inout DeferredWork, stage: SignalFusionStage<OutputValue, U>) {
+		self.stage = stage
+		super.init(source: source, dw: &dw, context: .direct)
+	}
+	
+	// Invoke the fused stages and send the results to the output
+	// - Returns: a function to use as the handler after activation
+	override func nextHandlerInternal() -> (Result<OutputValue, SignalEnd>) -> Void {
+		assert(source.unbalancedTryLock() == false)
+		guard let output = outputs.first, let outputSignal = output.destination.value, let ac = output.activationCount else { return initialHandlerInternal() }
+		let activated = source.delivery.isNormal
+		let predecessor: Unmanaged<AnyObject>? = Unmanaged.passUnretained(self)
+		
+		// Every time the handler is recreated, the state of every stage is reinitialized.
+		let processor = stage.makeProcessor()
+		
+		return { [weak outputSignal] r in
+			switch processor(r) {
+			case .none: break
+			case .single(let r):
+				if let os = outputSignal {
+					os.send(result: r, predecessor: predecessor, activationCount: ac, activated: activated)
+				}
+			case .array(let a):
+				if let os = outputSignal {
+					os.send(results: a, predecessor: predecessor, activationCount: ac, activated: activated)
+				}
+			}
+		}
+	}
+	
+	// Implementation of `SignalFusable`
+	func fusedSuccessorInternal<V, W>(_ next: SignalFusionStage<V, W>) -> Signal<W>? {
+		return fusedSuccessor(of: self, stage: stage, next: next)
+	}
 }
 
 /// A processor used by `combine(...)` to transform incoming `Signal`s into the "combine" type. The handler function is typically just a wrap of the preceeding `Result` in a `EitherResultX.resultY`. Other than that, it's a basic passthrough transformer
@@ -3038,11 +3950,21 @@ public class SignalMultiInput<InputValue>: SignalInput<InputValue> {
 	/// NOTE: on `SignalMultiInput` this is a relatively low performance convenience method; it calls `singleInput()` on each send. If you plan to send multiple results, it is more efficient to call `singleInput()`, retain the `SignalInput` that creates and call `SignalInput` on that single input.
 	///
 	/// - Parameter result: the value or error to send, composed as a `Result`
-	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled`.
+	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
 	public final override func send(result: Result<InputValue, SignalEnd>) -> SignalSendError? {
 		return singleInput().send(result: result)
 	}
 	
+	/// A batched version of `send(result:)`.
+	///
+	/// NOTE: like `send(result:)` on `SignalMultiInput`, this calls `singleInput()` on each invocation.
+	///
+	/// - Parameter results: the values or errors to send, in order, composed as `Result`s
+	/// - Returns: `nil` on success. Non-`nil` values include `SignalSendError.disconnected` if the `predecessor` or `activationCount` fail to match, `SignalSendError.inactive` if the current `delivery` state is `.disabled` and `SignalSendError.queueFull` if the result was refused by a bounded queue with the `.reject` policy.
+	public final override func send(contentsOf results: Array<Result<InputValue, SignalEnd>>) -> SignalSendError? {
+		return singleInput().send(contentsOf: results)
+	}
+	
 	/// Implementation of `Lifetime` removes all inputs and sends a `SignalComplete.cancelled` to the destination.
 	public final override func cancel() {
 		guard let sig = signal else { return }
@@ -3068,6 +3990,9 @@ public class SignalMergedInput<InputValue>: SignalMultiInput<InputValue> {
 	fileprivate let onLastInputClosed: SignalEnd?
 	fileprivate let onDeinit: SignalEnd
 	
+	// The predecessor connected by the last `replaceLatest` (weak, since the processor retains `self`). Accessed only inside the mutex of `signal`.
+	private var latest = Weak<SignalMultiInputProcessor<InputValue>>(nil)
+	
 	fileprivate init(signal: Signal<InputValue>, onLastInputClosed: SignalEnd? = nil, onDeinit: SignalEnd = .cancelled) {
 		self.onLastInputClosed = onLastInputClosed
 		self.onDeinit = onDeinit
@@ -3096,6 +4021,32 @@ public class SignalMergedInput<InputValue>: SignalMultiInput<InputValue> {
 		super.add(source, closePropagation: closePropagation, removeOnDeactivate: removeOnDeactivate)
 	}
 	
+	/// Connects `source` to the `Signal`, first removing the predecessor most recently connected by this function (if it's still connected). This is the hand-off used by `flatMapLatest` and `switchLatest`.
+	///
+	/// Unlike `remove` followed by `add`, the previous predecessor is identified by its connection (not found through its source) and the swap happens under a single lock of the destination `Signal` so the merge set is never empty.
+	///
+	/// - Parameters:
+	///   - source: the `Signal` to connect as a new predecessor
+	///   - closePropagation: behavior to use when `source` sends an error. See `SignalEndPropagation` for more.
+	///   - removeOnDeactivate: if true, then when the output is deactivated, this source will be removed from the merge set. If false, then the source will remain connected through deactivation.
+	public final func replaceLatest<U: SignalInterface>(with source: U, closePropagation: SignalEndPropagation, removeOnDeactivate: Bool = false) where U.OutputValue == InputValue {
+		guard let sig = signal else { return }
+		let processor = source.signal.attach { (s, dw) -> SignalMultiInputProcessor<InputValue> in
+			SignalMultiInputProcessor<InputValue>(source: s, multiInput: self, closePropagation: closePropagation, removeOnDeactivate: removeOnDeactivate, dw: &dw)
+		}
+		var dw = DeferredWork()
+		sig.sync {
+			if let previous = latest.value {
+				_ = sig.removePreceedingWithoutInterruptionInternal(previous, dw: &dw)
+			}
+			latest = Weak(processor)
+			
+			// This can't be `duplicate` since this a a new processor but `loop` is a precondition failure
+			try! sig.addPreceedingInternal(processor, param: nil, dw: &dw)
+		}
+		dw.runWork()
+	}
+	
 	/// Creates a new `SignalInput`/`Signal` pair, immediately adds the `Signal` to this `SignalMergedInput` and returns the `SignalInput`.
 	///
 	/// - Parameters:
@@ -3260,9 +4211,24 @@ public enum SignalActivationSelection {
 ///
 /// - disconnected:  the signal input has been disconnected from its target signal
 /// - inactive:  the signal graph is not activated (no outputs in the graph) and the Result was not sent
+/// - queueFull:  the signal's queue is bounded with the `.reject` policy, the queue was full and the Result was not sent
 public enum SignalSendError {
 	case disconnected
 	case inactive
+	case queueFull
+}
+
+/// When a `Signal` is limited using `bounded(capacity:policy:)` or `create(capacity:policy:)`, this type describes the handling of a value that arrives when the queue is full.
+///
+/// - dropOldest: the oldest queued value is discarded to make room for the new value
+/// - dropNewest: the new value is discarded
+/// - coalesceLatest: the new value replaces the most recently queued value
+/// - reject: the new value is discarded and the sender receives `SignalSendError.queueFull` (only available from `create(capacity:policy:)`)
+public enum SignalQueuePolicy {
+	case dropOldest
+	case dropNewest
+	case coalesceLatest
+	case reject
 }
 
 /// Attempts to bind a `SignalInput` to a bindable handler (`SignalMergeSet`, `SignalJunction` or `SignalCapture`) can fail in two different ways.
@@ -3303,3 +4269,108 @@ public enum EitherResult5<U, V, W, X, Y> {
 	case result4(Signal<X>.Result)
 	case result5(Signal<Y>.Result)
 }
+
+#if CWLSIGNAL_METRICS
+	/// Counters maintained by every `Signal` when CwlSignal is built with `CWLSIGNAL_METRICS` defined (they don't exist otherwise). Nothing defines it by default: set the `CWLSIGNAL_METRICS` environment variable when running `swift build` or `swift test`, or add it to `SWIFT_ACTIVE_COMPILATION_CONDITIONS` when building with Xcode. Each counter is updated inside the `Signal`'s mutex so there is no additional synchronization cost.
+	public struct SignalMetrics {
+		/// Results passed to the handler, either directly or after queueing
+		public internal(set) var delivered: Int = 0
+		
+		/// Results delivered immediately from `send`, without queueing
+		public internal(set) var direct: Int = 0
+		
+		/// Results added to the queue because the `Signal` was busy, blocked or activating
+		public internal(set) var queued: Int = 0
+		
+		/// The largest length the queue has reached
+		public internal(set) var queueHighWaterMark: Int = 0
+		
+		/// Results removed from the queue or refused because a bounded queue was full (see `bounded(capacity:policy:)`)
+		public internal(set) var dropped: Int = 0
+		
+		/// Total time spent blocked (`holdCount > 0`), in nanoseconds. Does not include a block in progress.
+		public internal(set) var heldNanoseconds: UInt64 = 0
+		
+		/// Acquisitions of the mutex where the initial `trylock` failed (i.e. another thread held the mutex)
+		public internal(set) var contendedLocks: Int = 0
+		
+		/// Failed `trylock` attempts, including each attempt made while spinning in a contended acquisition. Relative to `contendedLocks`, this shows how long the mutex is typically held when contended.
+		public internal(set) var failedTryLocks: Int = 0
+	}
+	
+	/// The metrics for one `Signal` in a graph, returned from `Signal.graphMetrics()`.
+	public struct SignalMetricsNode {
+		/// Identifies the `Signal`. Valid only while the `Signal` exists.
+		public let id: ObjectIdentifier
+		
+		/// The type of the `Signal`, including its `OutputValue`
+		public let signalType: String
+		
+		/// The type of the attached handler (e.g. `SignalTransformer<Int, String>`), if any
+		public let handlerType: String?
+		
+		/// The `id` of each preceeding `Signal`
+		public let predecessors: Array<ObjectIdentifier>
+		
+		/// The counters for this `Signal`
+		public let metrics: SignalMetrics
+	}
+	
+	extension Signal {
+		/// A snapshot of the counters for this `Signal`
+		public var metrics: SignalMetrics {
+			return sync { metricsStorage }
+		}
+		
+		/// Snapshots the metrics of every `Signal` connected to this one, by walking predecessors and outputs. Each `Signal` is captured under its own mutex, so the snapshots are not atomic across the whole graph.
+		///
+		/// - Returns: a node for each `Signal` in the graph, starting with `self`
+		public func graphMetrics() -> Array<SignalMetricsNode> {
+			var result = Array<SignalMetricsNode>()
+			var visited = Set<ObjectIdentifier>()
+			var pending: Array<SignalMetricsSource> = [self]
+			while let next = pending.popLast() {
+				guard visited.insert(ObjectIdentifier(next)).inserted else { continue }
+				let (node, neighbors) = next.metricsNode()
+				result.append(node)
+				pending.append(contentsOf: neighbors)
+			}
+			return result
+		}
+	}
+	
+	// Implemented by `Signal` so `graphMetrics` can traverse signals of different `OutputValue` types
+	private protocol SignalMetricsSource: class {
+		func metricsNode() -> (node: SignalMetricsNode, neighbors: Array<SignalMetricsSource>)
+	}
+	
+	// Implemented by `SignalProcessor` to expose its `source` and `outputs` to `graphMetrics`
+	private protocol SignalMetricsProcessor: class {
+		var metricsSource: SignalMetricsSource { get }
+		
+		// Must be invoked inside the mutex of the `metricsSource`
+		var metricsOutputsInternal: Array<SignalMetricsSource> { get }
+	}
+	
+	extension Signal: SignalMetricsSource {
+		fileprivate func metricsNode() -> (node: SignalMetricsNode, neighbors: Array<SignalMetricsSource>) {
+			return sync { () -> (node: SignalMetricsNode, neighbors: Array<SignalMetricsSource>) in
+				let predecessors = sortedPreceedingInternal.compactMap { ($0.base as? SignalMetricsProcessor)?.metricsSource }
+				let outputs = (signalHandler as? SignalMetricsProcessor)?.metricsOutputsInternal ?? []
+				let handlerType = signalHandler.map { String(describing: type(of: $0)) }
+				let node = SignalMetricsNode(id: ObjectIdentifier(self), signalType: String(describing: type(of: self)), handlerType: handlerType, predecessors: predecessors.map { ObjectIdentifier($0) }, metrics: metricsStorage)
+				return (node, predecessors + outputs)
+			}
+		}
+	}
+	
+	extension SignalProcessor: SignalMetricsProcessor {
+		fileprivate var metricsSource: SignalMetricsSource {
+			return source
+		}
+		
+		fileprivate var metricsOutputsInternal: Array<SignalMetricsSource> {
+			return outputs.compactMap { $0.destination.value }
+		}
+	}
+#endif
@@ -183,6 +183,14 @@ extension SignalChannel {
 		return next { $0.playback() }
 	}
 	
+	public func playback(capacity: Int) -> SignalChannel<InputInterface, SignalMulti<Interface.OutputValue>> {
+		return next { $0.playback(capacity: capacity) }
+	}
+	
+	public func playback(window: DispatchTimeInterval) -> SignalChannel<InputInterface, SignalMulti<Interface.OutputValue>> {
+		return next { $0.playback(window: window) }
+	}
+	
 	public func cacheUntilActive() -> SignalChannel<InputInterface, Signal<Interface.OutputValue>> {
 		return next { $0.cacheUntilActive() }
 	}
@@ -212,6 +220,10 @@ extension SignalChannel {
 		return next { $0.reduce(initialState: initialState, context: context, reducer) }
 	}
 	
+	public func freeze() -> SignalChannel<InputInterface, Signal<Interface.OutputValue>> {
+		return next { $0.signal.freeze() }
+	}
+	
 	public func capture() -> (input: InputInterface, capture: SignalCapture<Interface.OutputValue>) {
 		let tuple = final { $0.capture() }
 		return (input: tuple.input, capture: tuple.output)
@@ -309,24 +321,24 @@ extension SignalChannel {
 
 // Implementation of SignalReactive.swift
 extension SignalChannel {
-	public func buffer<Boundaries: SignalInterface>(boundaries: Boundaries) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
-		return next { $0.buffer(boundaries: boundaries) }
+	public func buffer<Boundaries: SignalInterface>(boundaries: Boundaries, recycleStorage: Bool = false) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
+		return next { $0.buffer(boundaries: boundaries, recycleStorage: recycleStorage) }
 	}
 	
 	public func buffer<Boundaries: SignalInterface>(windows: Boundaries) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> where Boundaries.OutputValue: SignalInterface {
 		return next { $0.buffer(windows: windows) }
 	}
 	
-	public func buffer(count: UInt, skip: UInt) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
-		return next { $0.buffer(count: count, skip: skip) }
+	public func buffer(count: UInt, skip: UInt, recycleStorage: Bool = false) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
+		return next { $0.buffer(count: count, skip: skip, recycleStorage: recycleStorage) }
 	}
 	
-	public func buffer(interval: DispatchTimeInterval, count: Int = Int.max, continuous: Bool = true, context: Exec = .direct) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
-		return next { $0.buffer(interval: interval, count: count, continuous: continuous, context: context) }
+	public func buffer(interval: DispatchTimeInterval, count: Int = Int.max, continuous: Bool = true, context: Exec = .direct, recycleStorage: Bool = false) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
+		return next { $0.buffer(interval: interval, count: count, continuous: continuous, context: context, recycleStorage: recycleStorage) }
 	}
 	
-	public func buffer(count: UInt) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
-		return next { $0.buffer(count: count, skip: count) }
+	public func buffer(count: UInt, recycleStorage: Bool = false) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
+		return next { $0.buffer(count: count, skip: count, recycleStorage: recycleStorage) }
 	}
 	
 	public func buffer(interval: DispatchTimeInterval, timeshift: DispatchTimeInterval, context: Exec = .direct) -> SignalChannel<InputInterface, Signal<[Interface.OutputValue]>> {
@@ -381,6 +393,14 @@ extension SignalChannel {
 		return next { $0.groupBy(context: context, processor) }
 	}
 	
+	public func groupBy<U: Hashable>(evictAfterIdle: DispatchTimeInterval, context: Exec = .direct, _ processor: @escaping (Interface.OutputValue) throws -> U) -> SignalChannel<InputInterface, Signal<(U, Signal<Interface.OutputValue>)>> {
+		return next { $0.groupBy(evictAfterIdle: evictAfterIdle, context: context, processor) }
+	}
+	
+	public func partition<U: Hashable>(by processor: @escaping (Interface.OutputValue) throws -> U, shards: Int = ProcessInfo.processInfo.activeProcessorCount, evictAfterIdle: DispatchTimeInterval? = nil, qos: DispatchQoS.QoSClass = .default, context: Exec = .direct) -> SignalChannel<InputInterface, Signal<(U, Signal<Interface.OutputValue>)>> {
+		return next { $0.partition(by: processor, shards: shards, evictAfterIdle: evictAfterIdle, qos: qos, context: context) }
+	}
+	
 	public func mapErrors(context: Exec = .direct, _ processor: @escaping (SignalEnd) -> SignalEnd) -> SignalChannel<InputInterface, Signal<Interface.OutputValue>> {
 		return next { $0.mapErrors(context: context, processor) }
 	}
@@ -393,6 +413,10 @@ extension SignalChannel {
 		return next { $0.map(context: context, processor) }
 	}
 	
+	public func concurrentMap<U>(maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount, preservingOrder: Bool = true, context: Exec = .global, _ processor: @escaping (Interface.OutputValue) throws -> U) -> SignalChannel<InputInterface, Signal<U>> {
+		return next { $0.concurrentMap(maxConcurrency: maxConcurrency, preservingOrder: preservingOrder, context: context, processor) }
+	}
+	
 	public func map<U, V>(initialState: V, context: Exec = .direct, _ processor: @escaping (inout V, Interface.OutputValue) throws -> U) -> SignalChannel<InputInterface, Signal<U>> {
 		return next { $0.map(initialState: initialState, context: context, processor) }
 	}
@@ -149,7 +149,7 @@ extension Signal {
 	/// Attaches a SignalOutput that applies all values to a target NSObject using key value coding via the supplied keyPath. The property must match the runtime type of the Signal signal values or a precondition failure will be raised.
 	///
 	/// - Parameters:
-	///   - context: the execution context where the setting will occur
+	///   - context: the execution context where the setting will occur (for frequently updated user-interface targets, `.mainCoalesced` avoids queuing a main thread block per value)
 	///   - target: the object upon which `setValue(_:forKeyPath:)` will be invoked
 	///   - keyPath: passed to `setValue(_:forKeyPath:)`
 	/// - Returns: the `SignalOutput` created by this action (releasing the output will cease any further setting)
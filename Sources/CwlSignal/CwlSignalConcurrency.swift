@@ -0,0 +1,323 @@
+//
+//  CwlSignalConcurrency.swift
+//  CwlSignal
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+
+#if SWIFT_PACKAGE
+	import CwlUtils
+#endif
+
+#if compiler(>=5.7)
+
+extension SignalInterface {
+	/// Converts the signal into an `AsyncSequence`, for iteration with `for try await`.
+	///
+	/// Values are queued by the subscription in the sending context and taken by the iterator in batches, so a busy signal costs one lock per batch rather than one suspension per value. The sequence ends (returns `nil`) when the signal completes or is cancelled, or when the iterating task is cancelled, and throws the underlying error when the signal ends with `.other`.
+	///
+	/// - Parameter bufferingPolicy: how values are retained while awaiting consumption
+	/// - Returns: the async sequence (the signal is subscribed immediately)
+	@available(OSX 10.15, iOS 13, tvOS 13, watchOS 6, *)
+	public func values(bufferingPolicy: SignalBufferingPolicy = .unbounded) -> SignalAsyncValues<OutputValue> {
+		return SignalAsyncValues<OutputValue>(signal, bufferingPolicy: bufferingPolicy)
+	}
+}
+
+/// Represents a Signal<OutputValue> converted to an asynchronously iterated sequence. Constructed using `values(bufferingPolicy:)`.
+@available(OSX 10.15, iOS 13, tvOS 13, watchOS 6, *)
+public final class SignalAsyncValues<OutputValue>: AsyncSequence {
+	public typealias Element = OutputValue
+	
+	let buffer: SignalPullBuffer<OutputValue>
+	var output: SignalOutput<OutputValue>? = nil
+	
+	/// Error type property is `nil` before the end of the signal is reached and contains the error used to close the signal in other cases
+	public var end: SignalEnd? {
+		return buffer.end
+	}
+	
+	// Only intended to be constructed by `Signal.values`
+	//
+	// - Parameters:
+	//   - signal: the signal whose values will be iterated by this sequence
+	//   - bufferingPolicy: how values are retained while awaiting consumption
+	init(_ signal: Signal<OutputValue>, bufferingPolicy: SignalBufferingPolicy) {
+		buffer = SignalPullBuffer<OutputValue>(policy: bufferingPolicy)
+		output = signal.subscribe { [buffer] r in buffer.receive(r) }
+	}
+	
+	/// Stops listening to the signal and set the error value to SignalComplete.cancelled
+	public func cancel() {
+		buffer.cancel()
+		output?.cancel()
+	}
+	
+	public func makeAsyncIterator() -> Iterator {
+		return Iterator(values: self)
+	}
+	
+	// Suspends until the buffer has values or has ended. Cancelling the waiting task cancels the sequence, which resumes the wait.
+	fileprivate func waitUntilAvailable() async {
+		await withTaskCancellationHandler {
+			await withUnsafeContinuation { (continuation: UnsafeContinuation<Void, Never>) in
+				buffer.whenAvailable { continuation.resume() }
+			}
+		} onCancel: {
+			self.cancel()
+		}
+	}
+	
+	public struct Iterator: AsyncIteratorProtocol {
+		let values: SignalAsyncValues<OutputValue>
+		var batch: [OutputValue] = []
+		var index: Int = 0
+		var finished: Bool = false
+		
+		init(values: SignalAsyncValues<OutputValue>) {
+			self.values = values
+		}
+		
+		public mutating func next() async throws -> OutputValue? {
+			while index == batch.count {
+				if finished {
+					return nil
+				}
+				let (taken, end) = values.buffer.takeBatch(max: Int.max)
+				if !taken.isEmpty {
+					batch = taken
+					index = 0
+					break
+				}
+				if let e = end {
+					finished = true
+					batch = []
+					index = 0
+					if case .other(let error) = e {
+						throw error
+					}
+					return nil
+				}
+				await values.waitUntilAvailable()
+			}
+			let value = batch[index]
+			index += 1
+			return value
+		}
+	}
+}
+
+extension SignalInput {
+	/// Wraps this input so that it can be sent values from async code with backpressure.
+	///
+	/// - Parameters:
+	///   - capacity: the number of values that may await delivery before `send` suspends
+	///   - context: where values are delivered to this input
+	/// - Returns: the bounded input
+	@available(OSX 10.15, iOS 13, tvOS 13, watchOS 6, *)
+	public func bounded(capacity: Int, context: Exec = .global) -> SignalBoundedInput<InputValue> {
+		return SignalBoundedInput<InputValue>(input: self, capacity: capacity, context: context)
+	}
+}
+
+/// An asynchronous front-end to a `SignalInput`. Sent values are queued and delivered to the input, in order, from `context`. When `capacity` values are queued awaiting delivery, `send` suspends until delivery catches up, so a slow signal graph applies backpressure to async producers without blocking a thread. Constructed using `SignalInput.bounded(capacity:context:)`.
+@available(OSX 10.15, iOS 13, tvOS 13, watchOS 6, *)
+public final class SignalBoundedInput<InputValue> {
+	public let input: SignalInput<InputValue>
+	public let capacity: Int
+	let context: Exec
+	
+	private let mutex = PThreadMutex()
+	private var queued = Deque<Result<InputValue, SignalEnd>>()
+	private var waiters = Deque<UnsafeContinuation<Void, Never>>()
+	private var draining = false
+	
+	// Only intended to be constructed by `SignalInput.bounded`
+	//
+	// - Parameters:
+	//   - input: the wrapped input
+	//   - capacity: the number of values that may await delivery before `send` suspends
+	//   - context: where values are delivered to `input`
+	init(input: SignalInput<InputValue>, capacity: Int, context: Exec) {
+		precondition(capacity > 0, "Capacity must be positive")
+		self.input = input
+		self.capacity = capacity
+		self.context = context
+	}
+	
+	/// Sends a value, suspending while `capacity` values are awaiting delivery.
+	///
+	/// - Parameter value: the value to send
+	public func send(_ value: InputValue) async {
+		await send(result: .success(value))
+	}
+	
+	/// Sends the end, suspending while `capacity` values are awaiting delivery.
+	///
+	/// - Parameter end: the end to send
+	public func send(end: SignalEnd) async {
+		await send(result: .failure(end))
+	}
+	
+	/// Sends `.complete`, suspending while `capacity` values are awaiting delivery.
+	public func complete() async {
+		await send(result: .failure(.complete))
+	}
+	
+	/// Sends a result, suspending while `capacity` values are awaiting delivery.
+	///
+	/// - Parameter result: the value or end to send
+	public func send(result: Result<InputValue, SignalEnd>) async {
+		while !tryEnqueue(result) {
+			await withUnsafeContinuation { (continuation: UnsafeContinuation<Void, Never>) in
+				mutex.unbalancedLock()
+				if queued.count < capacity {
+					mutex.unbalancedUnlock()
+					continuation.resume()
+				} else {
+					waiters.append(continuation)
+					mutex.unbalancedUnlock()
+				}
+			}
+		}
+	}
+	
+	private func tryEnqueue(_ result: Result<InputValue, SignalEnd>) -> Bool {
+		mutex.unbalancedLock()
+		guard queued.count < capacity else {
+			mutex.unbalancedUnlock()
+			return false
+		}
+		queued.append(result)
+		let startDrain = !draining
+		draining = true
+		mutex.unbalancedUnlock()
+		
+		if startDrain {
+			context.invokeAsync { self.drain() }
+		}
+		return true
+	}
+	
+	// Delivers everything queued as a batch. The batch stays in `queued` (counting against `capacity`) until it has been delivered, so no more than `capacity` values are ever outstanding. Suspended senders are then resumed to refill the queue.
+	private func drain() {
+		var delivered = 0
+		while true {
+			mutex.unbalancedLock()
+			queued.removeFirst(delivered)
+			let batch = Array(queued)
+			draining = !batch.isEmpty
+			let resumable = Array(waiters)
+			waiters.removeAll()
+			mutex.unbalancedUnlock()
+			
+			for w in resumable {
+				w.resume()
+			}
+			if batch.isEmpty {
+				return
+			}
+			for r in batch {
+				input.send(result: r)
+			}
+			delivered = batch.count
+		}
+	}
+}
+
+#endif
+
+#if compiler(>=5.9)
+
+/// A serial execution context that is also a Swift concurrency `SerialExecutor`.
+///
+/// An actor that returns `unownedExecutor` from an instance of this class shares its isolation domain with signal handlers invoked on `Exec.custom(executor)` (or `executor.context`), so those handlers may use `actor.assumeIsolated` to access actor state synchronously, rather than creating a `Task` per value and hopping twice.
+@available(OSX 14, iOS 17, tvOS 17, watchOS 10, *)
+public final class SignalSerialExecutor: SerialExecutor, CustomExecutionContext {
+	private let key = DispatchSpecificKey<Void>()
+	
+	/// The serial queue on which both signal handlers and actor jobs are run.
+	public let queue: DispatchQueue
+	
+	/// Constructs the executor around a new serial queue.
+	///
+	/// - Parameters:
+	///   - label: label for the underlying queue
+	///   - qos: quality-of-service for the underlying queue
+	public init(label: String = "", qos: DispatchQoS = .default) {
+		queue = DispatchQueue(label: label, qos: qos)
+		queue.setSpecific(key: key, value: ())
+	}
+	
+	/// The same context as `.custom(self)` but exposed as `.queue`, so timers are scheduled directly on the underlying queue.
+	public var context: Exec {
+		return .queue(queue, type)
+	}
+	
+	public var type: ExecutionType {
+		return .threadAsync { [key] in DispatchQueue.getSpecific(key: key) != nil }
+	}
+	
+	public var usesDispatchTimers: Bool {
+		return true
+	}
+	
+	public func invoke(_ execute: @escaping () -> Void) {
+		queue.async(execute: execute)
+	}
+	
+	public func invokeAsync(_ execute: @escaping () -> Void) {
+		queue.async(execute: execute)
+	}
+	
+	public func invokeSync<Return>(_ execute: () throws -> Return) rethrows -> Return {
+		if DispatchQueue.getSpecific(key: key) != nil {
+			return try execute()
+		}
+		return try queue.sync(execute: execute)
+	}
+	
+	public func singleTimer(interval: DispatchTimeInterval, leeway: DispatchTimeInterval, handler: @escaping () -> Void) -> Lifetime {
+		return context.singleTimer(interval: interval, leeway: leeway, handler: handler)
+	}
+	
+	public func singleTimer<T>(parameter: T, interval: DispatchTimeInterval, leeway: DispatchTimeInterval, handler: @escaping (T) -> Void) -> Lifetime {
+		return context.singleTimer(parameter: parameter, interval: interval, leeway: leeway, handler: handler)
+	}
+	
+	public func periodicTimer(interval: DispatchTimeInterval, leeway: DispatchTimeInterval, handler: @escaping () -> Void) -> Lifetime {
+		return context.periodicTimer(interval: interval, leeway: leeway, handler: handler)
+	}
+	
+	public func periodicTimer<T>(parameter: T, interval: DispatchTimeInterval, leeway: DispatchTimeInterval, handler: @escaping (T) -> Void) -> Lifetime {
+		return context.periodicTimer(parameter: parameter, interval: interval, leeway: leeway, handler: handler)
+	}
+	
+	public func enqueue(_ job: consuming ExecutorJob) {
+		let unownedJob = UnownedJob(job)
+		queue.async {
+			unownedJob.runSynchronously(on: self.asUnownedSerialExecutor())
+		}
+	}
+	
+	public func asUnownedSerialExecutor() -> UnownedSerialExecutor {
+		return UnownedSerialExecutor(ordinary: self)
+	}
+}
+
+#endif
@@ -80,6 +80,12 @@ extension SignalInterface {
 	public func playback() -> SignalMulti<OutputValue> {
 		return signal.playback()
 	}
+	public func playback(capacity: Int) -> SignalMulti<OutputValue> {
+		return signal.playback(capacity: capacity)
+	}
+	public func playback(window: DispatchTimeInterval) -> SignalMulti<OutputValue> {
+		return signal.playback(window: window)
+	}
 	public func cacheUntilActive() -> Signal<OutputValue> {
 		return signal.cacheUntilActive()
 	}
@@ -188,21 +194,24 @@ extension SignalInputInterface {
 	/// - Parameter value: will be wrapped and sent
 	/// - Returns: the return value from the underlying `send(result:)` function
 	public func send(_ values: InputValue...) {
-		let i = self.input
-		for v in values {
-			i.send(result: .success(v))
-		}
+		input.send(contentsOf: values.map { .success($0) })
 	}
 	
 	/// A convenience version of `send` that wraps a value in `Result.success` before sending
 	///
+	/// NOTE: the sequence is fully iterated before sending and the values are sent as a single batch (see `send(contentsOf:)` on `SignalInput`).
+	///
 	/// - Parameter value: will be wrapped and sent
 	/// - Returns: the return value from the underlying `send(result:)` function
 	public func send<S: Sequence>(sequence: S) where S.Iterator.Element == InputValue {
-		let i = self.input
-		for v in sequence {
-			i.send(result: .success(v))
-		}
+		input.send(contentsOf: sequence.map { .success($0) })
+	}
+	
+	/// A convenience version of `send(contentsOf:)` that accepts any sequence of `Result`s
+	///
+	/// - Parameter results: will be collected into an array and sent as a single batch
+	public func send<S: Sequence>(results: S) where S.Iterator.Element == Signal<InputValue>.Result {
+		input.send(contentsOf: Array(results))
 	}
 	
 	/// A convenience version of `send` that wraps an error in `Result.failure` before sending
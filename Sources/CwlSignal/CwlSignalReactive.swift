@@ -135,64 +135,199 @@ extension SignalInterface {
 }
 
 /// Represents a Signal<OutputValue> converted to a synchronously iterated sequence. Values can be obtained using typical SequenceType actions. The error that ends the sequence is available through the `error` property.
+///
+/// Values are obtained one at a time through `next()` or, with lower per-element overhead, as all values queued at the time of the call through `nextBatch(max:)` or `batches(max:)`.
 public class SignalSequence<OutputValue>: Sequence, IteratorProtocol {
 	typealias GeneratorType = SignalSequence<OutputValue>
 	typealias ElementType = OutputValue
 	
-	let semaphore = DispatchSemaphore(value: 0)
-	let context = Exec.syncQueue()
+	let buffer = SignalPullBuffer<OutputValue>()
 	var output: SignalOutput<OutputValue>? = nil
 	
-	var queued: Array<OutputValue> = []
-	
 	/// Error type property is `nil` before the end of the signal is reached and contains the error used to close the signal in other cases
-	public var end: SignalEnd?
+	public var end: SignalEnd? {
+		return buffer.end
+	}
 	
 	// Only intended to be constructed by `Signal.toSequence`
 	//
 	// - Parameter signal: the signal whose values will be iterated by this sequence
 	init(_ signal: Signal<OutputValue>) {
-		output = signal.subscribe(context: context) { [weak self] (r: Result<OutputValue, SignalEnd>) in
-			guard let s = self else { return }
-			switch r {
-			case .success(let v):
-				s.queued.append(v)
-				s.semaphore.signal()
-			case .failure(let e):
-				s.end = e
-				s.semaphore.signal()
-			}
-		}
+		output = signal.subscribe { [buffer] r in buffer.receive(r) }
 	}
 	
 	/// Stops listening to the signal and set the error value to SignalComplete.cancelled
 	public func cancel() {
-		context.invokeSync {
-			self.end = .cancelled
-			self.output?.cancel()
-			self.semaphore.signal()
-		}
+		buffer.cancel()
+		output?.cancel()
 	}
 	
 	/// Implementation of GeneratorType method.
 	public func next() -> OutputValue? {
-		_ = semaphore.wait(timeout: DispatchTime.distantFuture)
-		return context.invokeSync { [weak self] () -> OutputValue? in
-			guard let s = self else { return nil }
-			if !s.queued.isEmpty {
-				return s.queued.removeFirst()
-			} else {
-				// Signal the sempahore so that `nil` can be fetched again.
-				s.semaphore.signal()
-				return nil
-			}
+		return buffer.waitNext()
+	}
+	
+	/// Blocks until at least one value is available (or the signal ends) and then returns all queued values, up to `max`, removed under a single lock.
+	///
+	/// - Parameter max: the largest number of values to return
+	/// - Returns: a non-empty array of values or `nil` if the signal has ended and all values have been consumed
+	public func nextBatch(max: Int = Int.max) -> [OutputValue]? {
+		return buffer.waitBatch(max: max)
+	}
+	
+	/// A sequence over the batches returned by `nextBatch(max:)`.
+	///
+	/// - Parameter max: the largest number of values in each batch
+	/// - Returns: a sequence whose elements are non-empty arrays of values
+	public func batches(max: Int = Int.max) -> AnySequence<[OutputValue]> {
+		return AnySequence { AnyIterator { self.nextBatch(max: max) } }
+	}
+}
+
+/// Determines how values are retained when a signal is pulled by a consumer (e.g. using `values(bufferingPolicy:)`) more slowly than the signal sends.
+///
+/// - unbounded: every value is retained until consumed
+/// - bufferingOldest: when `limit` values are awaiting consumption, newly sent values are discarded
+/// - bufferingNewest: when `limit` values are awaiting consumption, the oldest value is discarded to make room
+public enum SignalBufferingPolicy {
+	case unbounded
+	case bufferingOldest(Int)
+	case bufferingNewest(Int)
+}
+
+// The storage behind `SignalSequence`. A subscription appends values and the end under a mutex; consumers remove values in batches under the same mutex. Blocking consumers wait on a condition (only signalled when a consumer is actually waiting) and non-blocking consumers can use `takeBatch(max:)` with a one-shot `whenAvailable(_:)` callback instead.
+final class SignalPullBuffer<OutputValue> {
+	private let policy: SignalBufferingPolicy
+	private let mutex = PThreadMutex()
+	private let condition = PThreadCondition()
+	private var queued = Deque<OutputValue>()
+	private var storedEnd: SignalEnd? = nil
+	private var waiting = 0
+	private var availableHandlers: [() -> Void] = []
+	
+	init(policy: SignalBufferingPolicy = .unbounded) {
+		self.policy = policy
+	}
+	
+	var end: SignalEnd? {
+		return mutex.sync { storedEnd }
+	}
+	
+	// Appends a value or records the end. Invoked by the subscription on the delivering thread.
+	//
+	// - Parameter result: the value or end to append
+	func receive(_ result: Result<OutputValue, SignalEnd>) {
+		mutex.unbalancedLock()
+		switch result {
+		case .success(let v):
+			switch policy {
+			case .unbounded: queued.append(v)
+			case .bufferingOldest(let limit) where queued.count < limit: queued.append(v)
+			case .bufferingOldest: break
+			case .bufferingNewest(let limit) where limit > 0:
+				if queued.count >= limit {
+					queued.removeFirst()
+				}
+				queued.append(v)
+			case .bufferingNewest: break
+			}
+		case .failure(let e) where storedEnd == nil: storedEnd = e
+		case .failure: break
+		}
+		let handlers = takeAvailableHandlersLocked(wakeAll: result.isFailure)
+		mutex.unbalancedUnlock()
+		handlers.forEach { $0() }
+	}
+	
+	// Ends the buffer with `.cancelled`. Any already queued values remain available.
+	func cancel() {
+		mutex.unbalancedLock()
+		storedEnd = .cancelled
+		let handlers = takeAvailableHandlersLocked(wakeAll: true)
+		mutex.unbalancedUnlock()
+		handlers.forEach { $0() }
+	}
+	
+	// Blocks until a value is available or the end is reached.
+	//
+	// - Returns: the oldest queued value or `nil` at the end
+	func waitNext() -> OutputValue? {
+		mutex.unbalancedLock()
+		defer { mutex.unbalancedUnlock() }
+		waitLocked()
+		return queued.isEmpty ? nil : queued.removeFirst()
+	}
+	
+	// Blocks until a value is available or the end is reached.
+	//
+	// - Parameter max: the largest number of values to return
+	// - Returns: up to `max` of the oldest queued values or `nil` at the end
+	func waitBatch(max: Int) -> [OutputValue]? {
+		mutex.unbalancedLock()
+		defer { mutex.unbalancedUnlock() }
+		waitLocked()
+		return queued.isEmpty ? nil : removeLocked(max: max)
+	}
+	
+	// Removes queued values without blocking.
+	//
+	// - Parameter max: the largest number of values to return
+	// - Returns: up to `max` of the oldest queued values (possibly empty) and the end, if it has been reached
+	func takeBatch(max: Int) -> (values: [OutputValue], end: SignalEnd?) {
+		return mutex.sync { (queued.isEmpty ? [] : removeLocked(max: max), storedEnd) }
+	}
+	
+	// Invokes `handler` once values or the end are available: immediately if they already are, otherwise from the next `receive` or `cancel`.
+	//
+	// - Parameter handler: invoked outside the mutex
+	func whenAvailable(_ handler: @escaping () -> Void) {
+		mutex.unbalancedLock()
+		if queued.isEmpty && storedEnd == nil {
+			availableHandlers.append(handler)
+			mutex.unbalancedUnlock()
+		} else {
+			mutex.unbalancedUnlock()
+			handler()
+		}
+	}
+	
+	private func waitLocked() {
+		while queued.isEmpty && storedEnd == nil {
+			waiting += 1
+			condition.wait(mutex: mutex)
+			waiting -= 1
 		}
 	}
 	
-	deinit {
-		if end == nil {
-			semaphore.signal()
+	private func removeLocked(max: Int) -> [OutputValue] {
+		let count = Swift.min(max, queued.count)
+		if count == queued.count {
+			let all = Array(queued)
+			queued.removeAll(keepingCapacity: true)
+			return all
+		}
+		var values = [OutputValue]()
+		values.reserveCapacity(count)
+		for _ in 0..<count {
+			values.append(queued.removeFirst())
+		}
+		return values
+	}
+	
+	private func takeAvailableHandlersLocked(wakeAll: Bool) -> [() -> Void] {
+		if waiting > 0 {
+			if wakeAll {
+				condition.broadcast()
+			} else {
+				condition.signal()
+			}
 		}
+		if availableHandlers.isEmpty {
+			return []
+		}
+		let handlers = availableHandlers
+		availableHandlers.removeAll()
+		return handlers
 	}
 }
 
@@ -382,26 +517,41 @@ extension SignalInterface {
 	
 	/// Implementation of [Reactive X operator "Buffer"](http://reactivex.io/documentation/operators/buffer.html) for non-overlapping/no-gap buffers.
 	///
-	/// - Parameter boundaries: when this `Signal` sends a value, the buffer is emitted and cleared
+	/// - Parameters:
+	///   - boundaries: when this `Signal` sends a value, the buffer is emitted and cleared
+	///   - recycleStorage: if `true`, the storage of each emitted array is reused for the next buffer once every receiver has released it (see `buffer(count:skip:recycleStorage:)`)
 	/// - Returns: a signal where the values are arrays of values from `self`, accumulated according to `boundaries`
-	public func buffer<Interface: SignalInterface>(boundaries: Interface) -> Signal<[OutputValue]> {
-		return combine(boundaries, initialState: [OutputValue]()) { (buffer: inout [OutputValue], cr: EitherResult2<OutputValue, Interface.OutputValue>) -> Signal<[OutputValue]>.Next in
+	public func buffer<Interface: SignalInterface>(boundaries: Interface, recycleStorage: Bool = false) -> Signal<[OutputValue]> {
+		return buffer(boundaries: boundaries, recycleStorage: recycleStorage, reservedCapacity: 0)
+	}
+	
+	// Implementation of `buffer(boundaries:recycleStorage:)` where the recycled buffer is constructed with `reservedCapacity` (so a buffer with a known maximum count doesn't grow element by element). Since the `count` may be far larger than a typical buffer, this is only worthwhile when the storage is reused: without recycling, `reservedCapacity` must be zero.
+	//
+	// When recycling, the emitted array is retained and only cleared when the next buffer starts, by which time receivers have usually released it so the storage is uniquely referenced and clearing keeps the capacity without allocating. If a receiver still holds the array, clearing copies-on-write, as if the array had never been retained.
+	private func buffer<Interface: SignalInterface>(boundaries: Interface, recycleStorage: Bool, reservedCapacity: Int) -> Signal<[OutputValue]> {
+		var initial = [OutputValue]()
+		initial.reserveCapacity(reservedCapacity)
+		return combine(boundaries, initialState: (buffer: initial, emitted: false)) { (state: inout (buffer: [OutputValue], emitted: Bool), cr: EitherResult2<OutputValue, Interface.OutputValue>) -> Signal<[OutputValue]>.Next in
+			if state.emitted {
+				state.buffer.removeAll(keepingCapacity: true)
+				state.emitted = false
+			}
 			switch cr {
 			case .result1(.success(let v)):
-				buffer.append(v)
+				state.buffer.append(v)
 				return .none
-			case .result1(.failure(let e)):
-				let b = buffer
-				buffer.removeAll()
+			case .result1(.failure(let e)), .result2(.failure(let e)):
+				let b = state.buffer
+				state.buffer = []
 				return .value(b, end: e)
 			case .result2(.success):
-				let b = buffer
-				buffer.removeAll()
+				if recycleStorage {
+					state.emitted = true
+					return .value(state.buffer)
+				}
+				let b = state.buffer
+				state.buffer = []
 				return .value(b)
-			case .result2(.failure(let e)):
-				let b = buffer
-				buffer.removeAll()
-				return .value(b, end: e)
 			}
 		}
 	}
@@ -444,21 +594,46 @@ extension SignalInterface {
 	/// - Parameters:
 	///   - count: the number of separate values to accumulate before emitting an array of values
 	///   - skip: the stride between the start of each new buffer (can be smaller than `count`, resulting in overlapping buffers)
+	///   - recycleStorage: if `true`, each array is emitted from storage that is retained and reused for the next buffer. When receivers release each array before the next is emitted (as is typical for synchronous receivers), this avoids allocating an array per emission. When a receiver keeps an array, the next buffer copies-on-write, so emitted arrays are never modified. Default is `false`, since the most recently emitted values remain retained until the next buffer is emitted.
 	/// - Returns: a signal where the values are arrays of length `count` of values from `self`, with start values separated by `skip`
-	public func buffer(count: UInt, skip: UInt) -> Signal<[OutputValue]> {
+	public func buffer(count: UInt, skip: UInt, recycleStorage: Bool = false) -> Signal<[OutputValue]> {
 		if count == 0 {
 			return Signal<[OutputValue]>.preclosed()
 		}
 		
-		let multi = multicast()
-		
-		// Create the two listeners to the "multi" signal carefully so that the window signal is *first* (so it reaches the buffer before the value signal)
-		let windowSignal = multi.stride(count: Int(skip)).map { _ in
-			// `count - 1` is the index of the count-th element but since `valuesSignal` will resolve before this, we need to fire 1 element sooner, hence `count - 2`
-			multi.elementAt(count - 2).ignoreElements(outputType: OutputValue.self)
+		// Only the latest `count` values can belong to an unfinished buffer so a `Deque` of that length is the only state needed. The buffer starting at each multiple of `skip` is emitted when the value `count - 1` after its start arrives.
+		let length = Int(count)
+		let step = Int(Swift.max(skip, 1))
+		var output = [OutputValue]()
+		if recycleStorage {
+			output.reserveCapacity(length)
+		}
+		return transform(initialState: (recent: Deque<OutputValue>(), received: 0, output: output)) { (state: inout (recent: Deque<OutputValue>, received: Int, output: [OutputValue]), r: Result<OutputValue, SignalEnd>) -> Signal<[OutputValue]>.Next in
+			switch r {
+			case .success(let v):
+				if state.recent.count == length {
+					state.recent.removeFirst()
+				}
+				state.recent.append(v)
+				state.received += 1
+				let start = state.received - length
+				if start >= 0 && start % step == 0 {
+					guard recycleStorage else { return .value(Array(state.recent)) }
+					state.output.removeAll(keepingCapacity: true)
+					state.output.append(contentsOf: state.recent)
+					return .value(state.output)
+				}
+				return .none
+			case .failure(let e):
+				// Emit any partially filled buffers, oldest first
+				let oldest = state.received - state.recent.count
+				let firstOpen = Swift.max(state.received - length + 1, 0)
+				let partial = Swift.stride(from: (firstOpen + step - 1) / step * step, to: state.received, by: step).map { start in
+					Array(state.recent.dropFirst(start - oldest))
+				}
+				return .values(sequence: partial, end: e)
+			}
 		}
-		
-		return multi.buffer(windows: windowSignal)
 	}
 	
 	/// Implementation of [Reactive X operator "Buffer"](http://reactivex.io/documentation/operators/buffer.html) for non-overlapping, periodic buffer start times and possibly limited buffer sizes.
@@ -468,25 +643,29 @@ extension SignalInterface {
 	///   - count: the number of separate values to accumulate before emitting an array of values
 	///   - continuous: if `true` (default), the `timeshift` periodic timer runs continuously (empty buffers may be emitted if a timeshift elapses without any source signals). If `false`, the periodic timer does start until the first value is received from the source and the periodic timer is paused when a buffer is emitted.
 	///   - context: context where the timer will be run
+	///   - recycleStorage: if `true`, the storage of each emitted array is reused for the next buffer once every receiver has released it (see `buffer(count:skip:recycleStorage:)`)
 	/// - Returns: a signal where the values are arrays of values from `self`, accumulated according to `windows
-	public func buffer(interval: DispatchTimeInterval, count: Int = Int.max, continuous: Bool = true, context: Exec = .direct) -> Signal<[OutputValue]> {
+	public func buffer(interval: DispatchTimeInterval, count: Int = Int.max, continuous: Bool = true, context: Exec = .direct, recycleStorage: Bool = false) -> Signal<[OutputValue]> {
 		let multi = multicast()
 		
 		// Create the two listeners to the "multi" signal carefully so that the raw signal is *first* (so it reaches the buffer before the boundary signal)
 		let valuesSignal = multi.map { v in v }
 		let boundarySignal = multi.timedCountedBoundary(interval: interval, count: count, continuous: continuous, context: context)
 		
-		return valuesSignal.buffer(boundaries: boundarySignal)
+		// The `count` is only an upper limit (the interval may elapse first), so the reservation is clamped. A recycled buffer retains any capacity it grows beyond this.
+		return valuesSignal.buffer(boundaries: boundarySignal, recycleStorage: recycleStorage, reservedCapacity: recycleStorage ? Swift.min(count, 1_024) : 0)
 	}
 	
 	/// Implementation of [Reactive X operator "Buffer"](http://reactivex.io/documentation/operators/buffer.html) for non-overlapping buffers of fixed length.
 	///
-	/// - Note: this is just a convenience wrapper around `buffer(count:skip:)` where `skip` equals `count`.
+	/// - Note: this is just a convenience wrapper around `buffer(count:skip:recycleStorage:)` where `skip` equals `count`.
 	///
-	/// - Parameter count: the number of separate values to accumulate before emitting an array of values
+	/// - Parameters:
+	///   - count: the number of separate values to accumulate before emitting an array of values
+	///   - recycleStorage: if `true`, the storage of each emitted array is reused for the next buffer once every receiver has released it (see `buffer(count:skip:recycleStorage:)`)
 	/// - Returns: a signal where the values are arrays of values from `self`, accumulated according to `count`
-	public func buffer(count: UInt) -> Signal<[OutputValue]> {
-		return buffer(count: count, skip: count)
+	public func buffer(count: UInt, recycleStorage: Bool = false) -> Signal<[OutputValue]> {
+		return buffer(count: count, skip: count, recycleStorage: recycleStorage)
 	}
 	
 	/// Implementation of [Reactive X operator "Buffer"](http://reactivex.io/documentation/operators/buffer.html) for periodic buffer start times and fixed duration buffers.
@@ -673,13 +852,8 @@ extension SignalInterface {
 	///   - processor: for each value emitted by `self`, outputs a new `Signal`
 	/// - Returns: a signal where every value from every `Signal` output by `processor` is merged into a single stream
 	public func flatMapLatest<Interface: SignalInterface>(context: Exec = .direct, _ processor: @escaping (OutputValue) throws -> Interface) -> Signal<Interface.OutputValue> {
-		return transformFlatten(initialState: nil, closePropagation: .errors, context: context) { (s: inout Signal<Interface.OutputValue>?, v: OutputValue, mergedInput: SignalMergedInput<Interface.OutputValue>) in
-			if let existing = s {
-				mergedInput.remove(existing)
-			}
-			let next = try processor(v).signal
-			mergedInput.add(next, closePropagation: .errors, removeOnDeactivate: true)
-			s = next
+		return transformFlatten(closePropagation: .errors, context: context) { (v: OutputValue, mergedInput: SignalMergedInput<Interface.OutputValue>) in
+			mergedInput.replaceLatest(with: try processor(v), closePropagation: .errors, removeOnDeactivate: true)
 		}
 	}
 	
@@ -789,6 +963,94 @@ extension SignalInterface {
 		}
 	}
 	
+	/// Implementation of [Reactive X operator "GroupBy"](http://reactivex.io/documentation/operators/groupby.html) where groups that receive no values for `evictAfterIdle` are completed and forgotten.
+	///
+	/// - Note: a value arriving for a key after its group has been evicted will start a new group (and emit a new child `Signal`) for that key.
+	///
+	/// - Parameters:
+	///   - evictAfterIdle: duration without values after which a group's child `Signal` is sent `.complete` and the key is removed
+	///   - context: the `Exec` where `processor` and the idle timer will be evaluated (default: .direct).
+	///   - processor: for each value emitted by `self`, outputs the "key" for the output `Signal`
+	/// - Returns: a parent `Signal` where values are tuples of a "key" and a child `Signal` that will contain all values from `self` associated with that "key".
+	public func groupBy<U: Hashable>(evictAfterIdle: DispatchTimeInterval, context: Exec = .direct, _ processor: @escaping (OutputValue) throws -> U) -> Signal<(U, Signal<OutputValue>)> {
+		return groupByInternal(evictAfterIdle: evictAfterIdle, shards: [], context: context, processor)
+	}
+	
+	/// A variant of "GroupBy" where each child `Signal` delivers its values on one of `shards` serial contexts, selected by the hash of its "key". Values for a given key remain in order but different keys can be processed in parallel.
+	///
+	/// - Parameters:
+	///   - processor: for each value emitted by `self`, outputs the "key" for the output `Signal`
+	///   - shards: number of serial contexts over which keys are distributed (default: the number of active processors)
+	///   - evictAfterIdle: if non-nil, groups that receive no values for this duration are sent `.complete` and the key is removed (default: nil)
+	///   - qos: quality-of-service for the shard contexts (default: .default)
+	///   - context: the `Exec` where `processor` (and the idle timer, if any) will be evaluated (default: .direct).
+	/// - Returns: a parent `Signal` where values are tuples of a "key" and a child `Signal` that will contain all values from `self` associated with that "key", delivered on that key's shard context.
+	public func partition<U: Hashable>(by processor: @escaping (OutputValue) throws -> U, shards: Int = ProcessInfo.processInfo.activeProcessorCount, evictAfterIdle: DispatchTimeInterval? = nil, qos: DispatchQoS.QoSClass = .default, context: Exec = .direct) -> Signal<(U, Signal<OutputValue>)> {
+		let shardContexts = (0..<Swift.max(shards, 1)).map { _ in Exec.queue(DispatchQueue(label: "", qos: DispatchQoS(qosClass: qos, relativePriority: 0)), .serialAsync) }
+		return groupByInternal(evictAfterIdle: evictAfterIdle, shards: shardContexts, context: context, processor)
+	}
+	
+	// Shared implementation of `groupBy(evictAfterIdle:...)` and `partition(by:...)`.
+	//
+	// - Parameters:
+	//   - evictAfterIdle: if non-nil, a periodic timer is merged into the source (as `nil` values) and groups with no values over this duration are completed on each tick
+	//   - shards: if non-empty, each child signal is re-delivered on the shard context selected by its key's hash
+	//   - context: the `Exec` where `processor` will be evaluated
+	//   - processor: outputs the "key" for each value
+	// - Returns: the parent signal of key and child signal tuples
+	private func groupByInternal<U: Hashable>(evictAfterIdle: DispatchTimeInterval?, shards: [Exec], context: Exec, _ processor: @escaping (OutputValue) throws -> U) -> Signal<(U, Signal<OutputValue>)> {
+		let serialContext = context.serialized()
+		let source: Signal<OutputValue?>
+		if let interval = evictAfterIdle {
+			let (mergedInput, signal) = Signal<OutputValue?>.createMergedInput()
+			mergedInput.add(map { v -> OutputValue? in v }, closePropagation: .all, removeOnDeactivate: false)
+			mergedInput.add(Signal<Int>.interval(interval, context: serialContext).map { _ -> OutputValue? in nil }, closePropagation: .none, removeOnDeactivate: false)
+			source = signal
+		} else {
+			source = map { v -> OutputValue? in v }
+		}
+		
+		typealias Group = (input: SignalInput<OutputValue>, lastSeen: DispatchTime)
+		return source.transform(initialState: Dictionary<U, Group>(), context: serialContext) { (groups: inout Dictionary<U, Group>, r: Result<OutputValue?, SignalEnd>) -> Signal<(U, Signal<OutputValue>)>.Next in
+			switch r {
+			case .success(.some(let v)):
+				do {
+					let u = try processor(v)
+					let now = evictAfterIdle != nil ? serialContext.timestamp() : DispatchTime(uptimeNanoseconds: 0)
+					if let g = groups[u] {
+						groups[u]?.lastSeen = now
+						g.input.send(value: v)
+						return .none
+					} else {
+						let (input, preCachedSignal) = Signal<OutputValue>.create()
+						var s = preCachedSignal.cacheUntilActive()
+						if !shards.isEmpty {
+							let shard = shards[Int(UInt(bitPattern: u.hashValue) % UInt(shards.count))]
+							s = s.transform(context: shard) { r in .single(r) }
+						}
+						input.send(value: v)
+						groups[u] = (input: input, lastSeen: now)
+						return .value((u, s))
+					}
+				} catch {
+					return .error(error)
+				}
+			case .success(.none):
+				// A tick of the idle timer: collect the expired keys first to avoid mutating `groups` while iterating
+				guard let interval = evictAfterIdle else { return .none }
+				let now = serialContext.timestamp()
+				let expired = groups.compactMap { tuple in tuple.value.lastSeen + interval <= now ? tuple.key : nil }
+				for key in expired {
+					groups.removeValue(forKey: key)?.input.send(end: .complete)
+				}
+				return .none
+			case .failure(let e):
+				groups.forEach { tuple in tuple.value.input.send(end: e) }
+				return .end(e)
+			}
+		}
+	}
+	
 	/// Implementation of [Reactive X operator "Map"](http://reactivex.io/documentation/operators/map.html)
 	///
 	/// - Parameters:
@@ -818,6 +1080,29 @@ extension SignalInterface {
 		}
 	}
 	
+	/// A variant of [Reactive X operator "Map"](http://reactivex.io/documentation/operators/map.html) where `processor` is evaluated for up to `maxConcurrency` values at once.
+	///
+	/// - Note: when `maxConcurrency` values are already being processed, delivery of the next value blocks until a slot frees. This stalls the upstream context (and any synchronous sender), so the concurrency bound acts as backpressure rather than an unbounded queue. Don't use a `context` that is also needed by the upstream signal graph.
+	///
+	/// - Parameters:
+	///   - maxConcurrency: maximum number of concurrent invocations of `processor` (default: the number of active processors)
+	///   - preservingOrder: if true (default), results are emitted in the order of the values that produced them; otherwise results are emitted as they complete.
+	///   - context: the `Exec` where `processor` will be evaluated. Must be concurrent for any parallelism to occur (default: .global).
+	///   - processor: for each value emitted by `self`, outputs a value for the output `Signal`
+	/// - Returns: a `Signal` where all the values have been transformed by the `processor`. An error thrown by `processor` ends the signal (in order, if `preservingOrder`). The end of `self` is emitted after all pending results.
+	public func concurrentMap<U>(maxConcurrency: Int = ProcessInfo.processInfo.activeProcessorCount, preservingOrder: Bool = true, context: Exec = .global, _ processor: @escaping (OutputValue) throws -> U) -> Signal<U> {
+		let (mergedInput, signal) = Signal<U>.createMergedInput()
+		let state = ConcurrentMapState<OutputValue, U>(maxConcurrency: maxConcurrency, preservingOrder: preservingOrder, context: context, output: HeldMergedInput(mergedInput), processor: processor)
+		let intermediate = transform { (r: Result<OutputValue, SignalEnd>) -> Signal<U>.Next in
+			state.submit(r)
+			return .none
+		}.onDeactivate {
+			state.reset()
+		}
+		mergedInput.add(intermediate, closePropagation: .none, removeOnDeactivate: false)
+		return signal
+	}
+	
 	/// Implementation of [Reactive X operator "Map"](http://reactivex.io/documentation/operators/map.html)
 	///
 	/// - Parameters:
@@ -1023,21 +1308,35 @@ extension SignalInterface {
 	///   - context: context where the timer will run
 	/// - Returns: a signal where values are emitted after a `interval` but only if no another value occurs during that `interval`.
 	public func debounce(interval: DispatchTimeInterval, flushOnClose: Bool = false, context: Exec = .direct) -> Signal<OutputValue> {
+		// A single reschedulable timer is reused for every value. Both the timer handler and the transform run in `serialContext` so `pending` needs no further synchronization.
 		let serialContext = context.serialized()
 		let (mergedInput, signal) = Signal<OutputValue>.createMergedInput()
-		let intermediate = transform(initialState: nil, context: serialContext) { (timer: inout Signal<OutputValue>?, result: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
+		let pending = TimedOperatorState<OutputValue?>(nil)
+		let output = HeldMergedInput(mergedInput)
+		let timer = serialContext.reschedulableTimer {
+			if let v = pending.value {
+				pending.value = nil
+				output.send(result: .success(v))
+			}
+		}
+		let intermediate = transform(context: serialContext) { (result: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
 			switch result {
 			case .success(let v):
-				if let oldTimer = timer {
-					mergedInput.remove(oldTimer)
-				}
-				let newTimer = Signal<OutputValue>.timer(interval: interval, value: v, context: serialContext)
-				mergedInput.add(newTimer, closePropagation: .none, removeOnDeactivate: true)
-				timer = newTimer
+				pending.value = v
+				timer.schedule(interval: interval)
 				return .none
 			case .failure(let e):
+				timer.cancel()
+				defer { pending.value = nil }
+				if flushOnClose, let v = pending.value {
+					return .array([.success(v), .failure(e)])
+				}
 				return .end(e)
 			}
+		}.onDeactivate(context: serialContext) {
+			// A value pending from a previous activation must not be emitted into the next
+			timer.cancel()
+			pending.value = nil
 		}
 		mergedInput.add(intermediate, closePropagation: .all, removeOnDeactivate: false)
 		return signal
@@ -1053,22 +1352,24 @@ extension SignalInterface {
 	/// - Returns: a signal where a timer is started when a value is received and emitted and further values received within that `interval` will be dropped.
 	public func throttleFirst(interval: DispatchTimeInterval, context: Exec = .direct) -> Signal<OutputValue> {
 		let timerQueue = context.serialized()
-		var timer: Lifetime? = nil
-		return transform(initialState: nil, context: timerQueue) { (cleanup: inout OnDelete?, r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
-			cleanup = cleanup ?? OnDelete {
-				timer = nil
-			}
-			
+		let open = TimedOperatorState<Bool>(true)
+		let timer = timerQueue.reschedulableTimer {
+			open.value = true
+		}
+		return transform(context: timerQueue) { (r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
 			switch r {
 			case .failure(let e):
+				timer.cancel()
 				return .end(e)
-			case .success(let v) where timer == nil:
-				timer = timerQueue.singleTimer(interval: interval) {
-					timer = nil
-				}
+			case .success(let v) where open.value:
+				open.value = false
+				timer.schedule(interval: interval)
 				return .value(v)
 			case .success: return .none
 			}
+		}.onDeactivate(context: timerQueue) {
+			timer.cancel()
+			open.value = true
 		}
 	}
 }
@@ -1359,7 +1660,7 @@ extension SignalInterface {
 	/// - Parameter count: the number of values from the end of `self` to drop
 	/// - Returns: a signal that buffers `count` values from `self` then for each new value received from `self`, emits the oldest value in the buffer. When `self` closes, all remaining values in the buffer are discarded.
 	public func skipLast(_ count: Int) -> Signal<OutputValue> {
-		return transform(initialState: Array<OutputValue>()) { (buffer: inout Array<OutputValue>, r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
+		return transform(initialState: Deque<OutputValue>()) { (buffer: inout Deque<OutputValue>, r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
 			switch r {
 			case .success(let v):
 				buffer.append(v)
@@ -1394,7 +1695,7 @@ extension SignalInterface {
 	/// - Parameter count: the number of values from the end of `self` to emit
 	/// - Returns: a signal that buffers `count` values from `self` then for each new value received from `self`, drops the oldest value in the buffer. When `self` closes, all values in the buffer are emitted, followed by the close.
 	public func takeLast(_ count: Int) -> Signal<OutputValue> {
-		return transform(initialState: Array<OutputValue>()) { (buffer: inout Array<OutputValue>, r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
+		return transform(initialState: Deque<OutputValue>()) { (buffer: inout Deque<OutputValue>, r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
 			switch r {
 			case .success(let v):
 				buffer.append(v)
@@ -1626,20 +1927,37 @@ extension SignalInterface {
 		return first.combineLatestWith(second, third, fourth, fifth, context: context, processor)
 	}
 	
-	public static func combineLatest<S: Sequence>(sequence: S) -> Signal<[OutputValue]> where S.Element: SignalInterface, OutputValue == S.Element.OutputValue {
+	/// Combines the latest value from each of an arbitrary number of signals of the same type.
+	///
+	/// Each value received updates a single slot in the latest values array. Until every signal has sent a value, nothing is emitted. After that, each value is written in place into the array that was previously emitted: when every receiver has released the previous array (as is typical for synchronous receivers) its storage is uniquely referenced and the update is O(1), otherwise the update copies-on-write, so emitted arrays never change. If the index of each update is needed, use `Signal.indexed` instead.
+	///
+	/// - Parameters:
+	///   - sequence: the signals to combine
+	///   - coalesce: if `true`, the result is `bounded(capacity: 1, policy: .coalesceLatest)` so while a receiver on an asynchronous context is busy, a burst of updates is held as a single, latest array
+	/// - Returns: a signal that emits the latest value from every signal in `sequence`, in the order of `sequence`, whenever any signal sends a value (once all have sent at least one value)
+	public static func combineLatest<S: Sequence>(sequence: S, coalesce: Bool = false) -> Signal<[OutputValue]> where S.Element: SignalInterface, OutputValue == S.Element.OutputValue {
 		let array = Array(sequence)
 		let count = array.count
 		let indexed = Signal<OutputValue>.indexed(array)
-		return indexed.transform(initialState: Array<OutputValue?>(repeating: nil, count: count)) { buffer, result in
+		let combined = indexed.transform(initialState: (pending: Array<OutputValue?>(repeating: nil, count: count), missing: count, latest: Array<OutputValue>())) { (state: inout (pending: Array<OutputValue?>, missing: Int, latest: Array<OutputValue>), result: Result<(offset: Int, element: OutputValue), SignalEnd>) -> Signal<[OutputValue]>.Next in
 			switch result {
+			case .success((let offset, let element)) where state.missing == 0:
+				state.latest[offset] = element
+				return .value(state.latest)
 			case .success((let offset, let element)):
-				buffer[offset] = element
-				let compacted = buffer.compactMap { $0 }
-				guard compacted.count == count else { return .none }
-				return .value(compacted)
+				// Until every signal has sent a value, only count the missing values rather than scanning
+				if state.pending[offset] == nil {
+					state.missing -= 1
+				}
+				state.pending[offset] = element
+				guard state.missing == 0 else { return .none }
+				state.latest = state.pending.map { $0! }
+				state.pending = []
+				return .value(state.latest)
 			case .failure(let e): return .end(e)
 			}
 		}
+		return coalesce ? combined.bounded(capacity: 1, policy: .coalesceLatest) : combined
 	}
 
 	public static func combineLatest<S: SignalInterface>(_ signals: S...) -> Signal<[OutputValue]> where OutputValue == S.OutputValue {
@@ -1844,13 +2162,8 @@ extension SignalInterface {
 	/// - Parameter signal: each of the inner signals emitted by this outer signal is observed, with the most recent signal emitted from the result
 	/// - Returns: a signal that emits the values from the latest `Signal` emitted by `signal`
 	public func switchLatest<U>() -> Signal<U> where OutputValue: SignalInterface, OutputValue.OutputValue == U {
-		return transformFlatten(initialState: nil, closePropagation: .errors) { (latest: inout Signal<U>?, next: OutputValue, mergedInput: SignalMergedInput<U>) in
-			if let l = latest {
-				mergedInput.remove(l)
-			}
-			let s = next.signal
-			mergedInput.add(s, closePropagation: .errors, removeOnDeactivate: true)
-			latest = s
+		return transformFlatten(closePropagation: .errors) { (next: OutputValue, mergedInput: SignalMergedInput<U>) in
+			mergedInput.replaceLatest(with: next, closePropagation: .errors, removeOnDeactivate: true)
 		}
 	}
 
@@ -1872,7 +2185,7 @@ extension SignalInterface {
 	/// - Parameter second: another `Signal`
 	/// - Returns: a signal that emits the values from `self`, paired with corresponding value from `with`.
 	public func zipWith<U: SignalInterface>(_ second: U) -> Signal<(OutputValue, U.OutputValue)> {
-		return combine(second, initialState: (Array<OutputValue>(), Array<U.OutputValue>(), false, false)) { (queues: inout (first: Array<OutputValue>, second: Array<U.OutputValue>, firstClosed: Bool, secondClosed: Bool), r: EitherResult2<OutputValue, U.OutputValue>) -> Signal<(OutputValue, U.OutputValue)>.Next in
+		return combine(second, initialState: (Deque<OutputValue>(), Deque<U.OutputValue>(), false, false)) { (queues: inout (first: Deque<OutputValue>, second: Deque<U.OutputValue>, firstClosed: Bool, secondClosed: Bool), r: EitherResult2<OutputValue, U.OutputValue>) -> Signal<(OutputValue, U.OutputValue)>.Next in
 			switch (r, queues.first.first, queues.second.first) {
 			case (.result1(.success(let first)), _, .some(let second)):
 				queues.second.removeFirst()
@@ -1935,7 +2248,7 @@ extension SignalInterface {
 	///   - third: another `Signal`
 	/// - Returns: a signal that emits the values from `self`, paired with corresponding value from `second` and `third`.
 	public func zipWith<U: SignalInterface, V: SignalInterface>(_ second: U, _ third: V) -> Signal<(OutputValue, U.OutputValue, V.OutputValue)> {
-		return combine(second, third, initialState: (Array<OutputValue>(), Array<U.OutputValue>(), Array<V.OutputValue>(), false, false, false)) { (queues: inout (first: Array<OutputValue>, second: Array<U.OutputValue>, third: Array<V.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool), r: EitherResult3<OutputValue, U.OutputValue, V.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue)>.Next in
+		return combine(second, third, initialState: (Deque<OutputValue>(), Deque<U.OutputValue>(), Deque<V.OutputValue>(), false, false, false)) { (queues: inout (first: Deque<OutputValue>, second: Deque<U.OutputValue>, third: Deque<V.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool), r: EitherResult3<OutputValue, U.OutputValue, V.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue)>.Next in
 			switch (r, queues.first.first, queues.second.first, queues.third.first) {
 			case (.result1(.success(let first)), _, .some(let second), .some(let third)):
 				queues.second.removeFirst()
@@ -2019,7 +2332,7 @@ extension SignalInterface {
 	///   - fourth: another `Signal`
 	/// - Returns: a signal that emits the values from `self`, paired with corresponding value from `second`,`third` and `fourth`.
 	public func zipWith<U: SignalInterface, V: SignalInterface, W: SignalInterface>(_ second: U, _ third: V, _ fourth: W) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue)> {
-		return combine(second, third, fourth, initialState: (Array<OutputValue>(), Array<U.OutputValue>(), Array<V.OutputValue>(), Array<W.OutputValue>(), false, false, false, false)) { (queues: inout (first: Array<OutputValue>, second: Array<U.OutputValue>, third: Array<V.OutputValue>, fourth: Array<W.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool, fourthClosed: Bool), r: EitherResult4<OutputValue, U.OutputValue, V.OutputValue, W.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue)>.Next in
+		return combine(second, third, fourth, initialState: (Deque<OutputValue>(), Deque<U.OutputValue>(), Deque<V.OutputValue>(), Deque<W.OutputValue>(), false, false, false, false)) { (queues: inout (first: Deque<OutputValue>, second: Deque<U.OutputValue>, third: Deque<V.OutputValue>, fourth: Deque<W.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool, fourthClosed: Bool), r: EitherResult4<OutputValue, U.OutputValue, V.OutputValue, W.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue)>.Next in
 			switch (r, queues.first.first, queues.second.first, queues.third.first, queues.fourth.first) {
 			case (.result1(.success(let first)), _, .some(let second), .some(let third), .some(let fourth)):
 				queues.second.removeFirst()
@@ -2128,7 +2441,7 @@ extension SignalInterface {
 	///   - fifth: another `Signal`
 	/// - Returns: a signal that emits the values from `self`, paired with corresponding value from `second`,`third`, `fourth` and `fifth`.
 	public func zipWith<U: SignalInterface, V: SignalInterface, W: SignalInterface, X: SignalInterface>(_ second: U, _ third: V, _ fourth: W, _ fifth: X) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue, X.OutputValue)> {
-		return combine(second, third, fourth, fifth, initialState: (Array<OutputValue>(), Array<U.OutputValue>(), Array<V.OutputValue>(), Array<W.OutputValue>(), Array<X.OutputValue>(), false, false, false, false, false)) { (queues: inout (first: Array<OutputValue>, second: Array<U.OutputValue>, third: Array<V.OutputValue>, fourth: Array<W.OutputValue>, fifth: Array<X.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool, fourthClosed: Bool, fifthClosed: Bool), r: EitherResult5<OutputValue, U.OutputValue, V.OutputValue, W.OutputValue, X.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue, X.OutputValue)>.Next in
+		return combine(second, third, fourth, fifth, initialState: (Deque<OutputValue>(), Deque<U.OutputValue>(), Deque<V.OutputValue>(), Deque<W.OutputValue>(), Deque<X.OutputValue>(), false, false, false, false, false)) { (queues: inout (first: Deque<OutputValue>, second: Deque<U.OutputValue>, third: Deque<V.OutputValue>, fourth: Deque<W.OutputValue>, fifth: Deque<X.OutputValue>, firstClosed: Bool, secondClosed: Bool, thirdClosed: Bool, fourthClosed: Bool, fifthClosed: Bool), r: EitherResult5<OutputValue, U.OutputValue, V.OutputValue, W.OutputValue, X.OutputValue>) -> Signal<(OutputValue, U.OutputValue, V.OutputValue, W.OutputValue, X.OutputValue)>.Next in
 			switch (r, queues.first.first, queues.second.first, queues.third.first, queues.fourth.first, queues.fifth.first) {
 			case (.result1(.success(let first)), _, .some(let second), .some(let third), .some(let fourth), .some(let fifth)):
 				queues.second.removeFirst()
@@ -2235,6 +2548,166 @@ extension SignalInterface {
 	}
 }
 
+// Mutable state shared between a transform and the `ReschedulableTimer` handler in timed operators like `debounce`. Both must run in the same serialized context.
+fileprivate final class TimedOperatorState<Value> {
+	var value: Value
+	init(_ value: Value) {
+		self.value = value
+	}
+}
+
+// A single `SignalInput` to a `SignalMergedInput`, used by operators that send from outside the graph (like a timer handler). Sending directly on the merged input would construct a new input, `Signal` and processor for every send and, since those inputs use `.none` close propagation, would discard any end. The input is replaced only when a deactivation has invalidated it. Not thread-safe: sends must be serialized.
+fileprivate final class HeldMergedInput<Value> {
+	let mergedInput: SignalMergedInput<Value>
+	var input: SignalInput<Value>
+	
+	init(_ mergedInput: SignalMergedInput<Value>) {
+		self.mergedInput = mergedInput
+		self.input = mergedInput.singleInput(closePropagation: .all, removeOnDeactivate: true)
+	}
+	
+	func send(result: Result<Value, SignalEnd>) {
+		if case .disconnected? = input.send(result: result) {
+			input = mergedInput.singleInput(closePropagation: .all, removeOnDeactivate: true)
+			input.send(result: result)
+		}
+	}
+}
+
+// The reorder buffer and concurrency bound used by `concurrentMap`. Work items run on `context` and results are sent to `output` by whichever thread holds the `draining` flag, so there is only ever one sender and results can't be reordered after they leave the buffer.
+fileprivate final class ConcurrentMapState<OutputValue, U> {
+	let mutex = PThreadMutex()
+	let slots: DispatchSemaphore
+	let preservingOrder: Bool
+	let context: Exec
+	let output: HeldMergedInput<U>
+	let processor: (OutputValue) throws -> U
+	
+	// Incremented by `reset` so that work items still running from before a deactivation are discarded when they complete
+	var generation = 0
+	var nextSequence = 0
+	var nextToEmit = 0
+	var inFlight = 0
+	var completed = Dictionary<Int, Result<U, SignalEnd>>()
+	var ready = Array<Result<U, SignalEnd>>()
+	var pendingEnd: SignalEnd? = nil
+	var finished = false
+	var draining = false
+	
+	init(maxConcurrency: Int, preservingOrder: Bool, context: Exec, output: HeldMergedInput<U>, processor: @escaping (OutputValue) throws -> U) {
+		self.slots = DispatchSemaphore(value: Swift.max(maxConcurrency, 1))
+		self.preservingOrder = preservingOrder
+		self.context = context
+		self.output = output
+		self.processor = processor
+	}
+	
+	// Invoked, in order, for each result from the upstream signal. Blocks while all slots are in use.
+	//
+	// - Parameter result: the upstream result
+	func submit(_ result: Result<OutputValue, SignalEnd>) {
+		switch result {
+		case .success(let v):
+			slots.wait()
+			let sequence: (generation: Int, index: Int)? = mutex.sync {
+				if finished { return nil }
+				inFlight += 1
+				nextSequence += 1
+				return (generation, nextSequence - 1)
+			}
+			guard let s = sequence else {
+				slots.signal()
+				return
+			}
+			context.invokeAsync {
+				let r = Result<U, Error> { try self.processor(v) }.mapError(SignalEnd.other)
+				self.slots.signal()
+				self.complete(sequence: s, result: r)
+			}
+		case .failure(let e):
+			mutex.sync { pendingEnd = e }
+			complete(sequence: nil, result: nil)
+		}
+	}
+	
+	// Records a completed work item (or just the upstream end, if `sequence` is nil) then emits whatever is ready.
+	//
+	// - Parameters:
+	//   - sequence: the generation in which the value was submitted and its position in upstream order
+	//   - result: the value or error produced by `processor`
+	private func complete(sequence: (generation: Int, index: Int)?, result: Result<U, SignalEnd>?) {
+		mutex.sync {
+			if case let (g, s)? = sequence, let r = result {
+				guard g == generation else { return }
+				inFlight -= 1
+				if finished {
+					return
+				} else if preservingOrder {
+					completed[s] = r
+					while let next = completed.removeValue(forKey: nextToEmit) {
+						nextToEmit += 1
+						ready.append(next)
+						if next.isFailure {
+							finished = true
+							completed.removeAll()
+							break
+						}
+					}
+				} else {
+					ready.append(r)
+					finished = r.isFailure
+				}
+			}
+			if !finished, inFlight == 0, let e = pendingEnd {
+				finished = true
+				ready.append(.failure(e))
+			}
+		}
+		drain()
+	}
+	
+	// Discards all ordering and end state when the output deactivates, so a reactivated signal starts again from the first value. Work items still running keep their slots until they complete.
+	func reset() {
+		mutex.sync {
+			generation += 1
+			nextSequence = 0
+			nextToEmit = 0
+			inFlight = 0
+			completed.removeAll()
+			ready.removeAll()
+			pendingEnd = nil
+			finished = false
+		}
+	}
+	
+	// Sends `ready` results outside the mutex. If another thread is already draining, it will pick up any results appended in the meantime.
+	private func drain() {
+		let claimed: Bool = mutex.sync {
+			if draining || ready.isEmpty { return false }
+			draining = true
+			return true
+		}
+		guard claimed else { return }
+		
+		var batch = Array<Result<U, SignalEnd>>()
+		while true {
+			mutex.sync {
+				swap(&batch, &ready)
+				if batch.isEmpty {
+					draining = false
+				}
+			}
+			if batch.isEmpty {
+				return
+			}
+			for r in batch {
+				output.send(result: r)
+			}
+			batch.removeAll(keepingCapacity: true)
+		}
+	}
+}
+
 // Essentially a closure type used by `catchError`, defined as a separate class so the function can reference itself
 fileprivate class CatchErrorRecovery<OutputValue> {
 	let recover: (SignalEnd) -> Signal<OutputValue>
@@ -2585,21 +3058,26 @@ extension SignalInterface {
 	///   - context: timestamps will be added based on the time in this context
 	/// - Returns: a mirror of self unless a timeout occurs, in which case it will closed by a SignalReactiveError.timeout
 	public func timeout(interval: DispatchTimeInterval, resetOnValue: Bool = true, context: Exec = .direct) -> Signal<OutputValue> {
-		let (input, s) = Signal<Void>.create()
-		let junction = Signal<Void>.timer(interval: interval, context: context).junction()
-		// Both `junction` and `input` are newly created so this can't be an error
-		try! junction.bind(to: input)
-		return combine(s, context: context) { (cr: EitherResult2<OutputValue, ()>) -> Signal<OutputValue>.Next in
-			switch cr {
-			case .result1(let r):
-				if resetOnValue {
-					junction.rebind()
-				}
-				return .single(r)
-			case .result2:
-				return .end(.other(SignalReactiveError.timeout))
+		let serialContext = context.serialized()
+		let (mergedInput, signal) = Signal<OutputValue>.createMergedInput()
+		let output = HeldMergedInput(mergedInput)
+		let timer = serialContext.reschedulableTimer {
+			output.send(result: .failure(.other(SignalReactiveError.timeout)))
+		}
+		let intermediate = transform(context: serialContext) { (r: Result<OutputValue, SignalEnd>) -> Signal<OutputValue>.Next in
+			switch r {
+			case .success where resetOnValue: timer.schedule(interval: interval)
+			case .success: break
+			case .failure: timer.cancel()
 			}
+			return .single(r)
+		}.onActivate {
+			timer.schedule(interval: interval)
+		}.onDeactivate {
+			timer.cancel()
 		}
+		mergedInput.add(intermediate, closePropagation: .all, removeOnDeactivate: false)
+		return signal
 	}
 	
 	/// Implementation of [Reactive X operator "Timestamp"](http://reactivex.io/documentation/operators/timestamp.html)
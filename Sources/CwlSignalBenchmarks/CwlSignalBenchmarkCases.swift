@@ -0,0 +1,259 @@
+//
+//  CwlSignalBenchmarkCases.swift
+//  CwlSignalBenchmarks
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import CwlUtils
+import CwlSignal
+
+/// The number of inputs used by the "merge" benchmark
+let mergeInputCount = 8
+
+/// The number of values by which the first input leads the second in the "zipLeading" benchmark
+let zipLead = 100_000
+
+/// The number of values in each array emitted by the "buffer" and "bufferRecycled" benchmarks
+let bufferLength = 64
+
+/// The number of periodic timers (spread across `debugSimulationThreadCount` simulated threads) pending throughout the "debugSimulation" benchmark
+let debugSimulationTimerCount = 4_096
+
+/// The number of simulated threads used by the "debugSimulation" benchmark
+let debugSimulationThreadCount = 16
+
+/// The operator matrix. Each case applies the benchmark context to its operators, where the operator accepts a context, and otherwise to a `map` immediately following the operator.
+let benchmarkCases: Array<BenchmarkCase> = [
+	BenchmarkCase("mapFilter") { context, record in
+		let (input, signal) = Signal<UInt64>.create()
+		let wait = recording(signal.map(context: context) { $0 }.filter(context: context) { $0 != 0 }, record)
+		return { count in
+			for _ in 0..<count {
+				input.send(now())
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("combineLatest") { context, record in
+		let (input1, signal1) = Signal<UInt64>.create()
+		let (input2, signal2) = Signal<UInt64>.create()
+		let wait = recording(signal1.combineLatest(signal2, context: context) { v, _ in v }, record)
+		return { count in
+			input2.send(0)
+			for _ in 0..<count {
+				input1.send(now())
+			}
+			input1.complete()
+			input2.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("zip") { context, record in
+		let (input1, signal1) = Signal<UInt64>.create()
+		let (input2, signal2) = Signal<UInt64>.create()
+		let wait = recording(signal1.zip(signal2).map(context: context) { $0.0 }, record)
+		return { count in
+			for _ in 0..<count {
+				let t = now()
+				input1.send(t)
+				input2.send(t)
+			}
+			input1.complete()
+			input2.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("zipLeading") { context, record in
+		// The first input is pre-filled so its zip queue stays `zipLead` values deep while the second input catches up
+		let (input1, signal1) = Signal<UInt64>.create()
+		let (input2, signal2) = Signal<UInt64>.create()
+		let wait = recording(signal1.zip(signal2).map(context: context) { $0.1 }, record)
+		for _ in 0..<zipLead {
+			input1.send(0)
+		}
+		return { count in
+			for _ in 0..<count {
+				let t = now()
+				input1.send(t)
+				input2.send(t)
+			}
+			input1.complete()
+			input2.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("flatMapLatest") { context, record in
+		let (input, signal) = Signal<UInt64>.create()
+		let wait = recording(signal.flatMapLatest(context: context) { Signal<UInt64>.just($0) }, record)
+		return { count in
+			for _ in 0..<count {
+				input.send(now())
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("switchLatest") { context, record in
+		// Inner signals (other than the last) remain open, so every item hands off from a connected inner signal to the next
+		let (input, signal) = Signal<Signal<UInt64>>.create()
+		let wait = recording(signal.switchLatest().map(context: context) { $0 }, record)
+		return { count in
+			for i in 0..<count {
+				input.send(Signal<UInt64>.just(now(), end: i == count - 1 ? .complete : nil))
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("debounce", scale: 0.01) { context, record in
+		// Values are sent in bursts of 10, separated by twice the debounce interval, so one value is emitted per burst
+		let (input, signal) = Signal<UInt64>.create()
+		let wait = recording(signal.debounce(interval: .microseconds(500), context: context), record)
+		return { count in
+			for i in 0..<count {
+				input.send(now())
+				if i % 10 == 9 {
+					usleep(1_000)
+				}
+			}
+			usleep(1_000)
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("playback") { context, record in
+		let (input, signal) = Signal<UInt64>.create()
+		let multi = signal.playback()
+		let wait = recording(multi.map(context: context) { $0 }, record)
+		return { count in
+			for _ in 0..<count {
+				input.send(now())
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("merge") { context, record in
+		// Each input is driven from its own thread
+		let pairs = (0..<mergeInputCount).map { _ in Signal<UInt64>.create() }
+		let wait = recording(Signal<UInt64>.merge(sequence: pairs.map { $0.signal }).map(context: context) { $0 }, record)
+		return { count in
+			DispatchQueue.concurrentPerform(iterations: mergeInputCount) { index in
+				for _ in 0..<(count / mergeInputCount) {
+					pairs[index].input.send(now())
+				}
+				pairs[index].input.complete()
+			}
+			wait()
+		}
+	},
+	BenchmarkCase("buffer") { context, record in
+		let (input, signal) = Signal<UInt64>.create()
+		let wait = recording(signal.buffer(count: UInt(bufferLength)).map(context: context) { $0[0] }, record)
+		return { count in
+			for _ in 0..<count {
+				input.send(now())
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("bufferRecycled") { context, record in
+		// As for "buffer" but reusing array storage. Each array is released by `map` before the next buffer fills, so allocations per emission approach zero (in asynchronous contexts, arrays still queued for `map` must be copied).
+		let (input, signal) = Signal<UInt64>.create()
+		let wait = recording(signal.buffer(count: UInt(bufferLength), recycleStorage: true).map(context: context) { $0[0] }, record)
+		return { count in
+			for _ in 0..<count {
+				input.send(now())
+			}
+			input.complete()
+			wait()
+		}
+	},
+	BenchmarkCase("nodeMemory", scale: 0.1) { context, record in
+		// Each item constructs and subscribes a two node graph (an input `Signal` and a mapped `Signal`) which remains alive until the end of the run, so "bytes/item" is the heap footprint of a live graph (plus 16 bytes for the array retaining it) and the latency is its construction time
+		return { count in
+			var graphs = Array<(input: SignalInput<UInt64>, output: SignalOutput<UInt64>)>()
+			graphs.reserveCapacity(count)
+			for _ in 0..<count {
+				let t = now()
+				let (input, signal) = Signal<UInt64>.create()
+				graphs.append((input: input, output: signal.map(context: context) { $0 }.subscribe { _ in }))
+				record(t)
+			}
+			withExtendedLifetime(graphs) {}
+		}
+	},
+	BenchmarkCase("signalSequence") { context, record in
+		// The sequence is iterated on the benchmark thread while values are sent from another thread
+		let (input, signal) = Signal<UInt64>.create()
+		let sequence = signal.map(context: context) { $0 }.toSequence()
+		return { count in
+			DispatchQueue.global().async {
+				for _ in 0..<count {
+					input.send(now())
+				}
+				input.complete()
+			}
+			for t in sequence {
+				record(t)
+			}
+		}
+	},
+	BenchmarkCase("signalSequenceBatch") { context, record in
+		// As for "signalSequence" but draining everything queued under a single lock with each call
+		let (input, signal) = Signal<UInt64>.create()
+		let sequence = signal.map(context: context) { $0 }.toSequence()
+		return { count in
+			DispatchQueue.global().async {
+				for _ in 0..<count {
+					input.send(now())
+				}
+				input.complete()
+			}
+			while let batch = sequence.nextBatch() {
+				for t in batch {
+					record(t)
+				}
+			}
+		}
+	},
+	BenchmarkCase("debugSimulation") { context, record in
+		// Each item is one simulated timer firing on a `DebugContextCoordinator` with `debugSimulationTimerCount` timers pending, so the latency is the cost of one scheduler step (the benchmark context is not used)
+		let coordinator = DebugContextCoordinator()
+		let threads = [coordinator.global, coordinator.main] + (2..<debugSimulationThreadCount).map { _ in coordinator.asyncQueue() }
+		return { count in
+			var remaining = count
+			var last = now()
+			let timers = (0..<debugSimulationTimerCount).map { i -> Lifetime in
+				threads[i % threads.count].periodicTimer(interval: .milliseconds(1 + (i * 7919) % 1_000), leeway: .seconds(0)) {
+					record(last)
+					last = now()
+					remaining -= 1
+					if remaining == 0 {
+						coordinator.stop()
+					}
+				}
+			}
+			last = now()
+			coordinator.runScheduledTasks()
+			withExtendedLifetime(timers) {}
+		}
+	}
+]
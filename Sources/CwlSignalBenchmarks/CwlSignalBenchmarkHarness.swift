@@ -0,0 +1,204 @@
+//
+//  CwlSignalBenchmarkHarness.swift
+//  CwlSignalBenchmarks
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import CwlUtils
+import CwlSignal
+
+/// Monotonic time in nanoseconds. Values sent through each benchmark graph are timestamps from this function, so the latency of each item is the difference between its arrival time and its value.
+func now() -> UInt64 {
+	return DispatchTime.now().uptimeNanoseconds
+}
+
+/// A single operator benchmark.
+struct BenchmarkCase {
+	/// Identifies the case in results and on the command line
+	let name: String
+	
+	/// The fraction of the requested item count to use (for operators that must wait between items)
+	let scale: Double
+	
+	/// Constructs the graph for the given `Exec`, passing every timestamp emitted to `record`. Returns a function that sends the given number of timestamps, closes the inputs and returns only when the output has ended.
+	let build: (_ context: Exec, _ record: @escaping (UInt64) -> Void) -> (_ count: Int) -> Void
+	
+	init(_ name: String, scale: Double = 1, build: @escaping (_ context: Exec, _ record: @escaping (UInt64) -> Void) -> (_ count: Int) -> Void) {
+		self.name = name
+		self.scale = scale
+		self.build = build
+	}
+}
+
+/// The result of running one `BenchmarkCase` in one context. Latencies are in nanoseconds.
+struct BenchmarkResult: Codable {
+	let benchmark: String
+	let context: String
+	let items: Int
+	let outputs: Int
+	let seconds: Double
+	let itemsPerSecond: Double
+	let p50: Double
+	let p99: Double
+	let p999: Double
+	
+	/// Swift heap allocations per item sent, or `nil` if allocations can't be counted on this platform
+	let allocationsPerItem: Double?
+	
+	/// Bytes requested by those allocations per item sent, or `nil` if allocations can't be counted on this platform
+	let bytesPerItem: Double?
+}
+
+/// Subscribes `record` to the values from `signal` and returns a function that blocks until `signal` ends.
+///
+/// - Parameters:
+///   - signal: the output of a benchmark graph
+///   - record: receives each value
+/// - Returns: a function that waits for the end of `signal`
+func recording(_ signal: Signal<UInt64>, _ record: @escaping (UInt64) -> Void) -> () -> Void {
+	let semaphore = DispatchSemaphore(value: 0)
+	let output = signal.subscribe { r in
+		switch r {
+		case .success(let t): record(t)
+		case .failure: semaphore.signal()
+		}
+	}
+	return {
+		semaphore.wait()
+		output.cancel()
+	}
+}
+
+/// Runs `benchmark` in `context`, sending `count` items (adjusted by the benchmark's `scale`).
+///
+/// - Parameters:
+///   - benchmark: the case to run
+///   - context: the `Exec` used for the operators in the graph
+///   - contextName: the name of the context in the result
+///   - count: the unscaled number of items
+/// - Returns: the latencies, throughput and allocations of the run
+func run(_ benchmark: BenchmarkCase, context: Exec, contextName: String, count: Int) -> BenchmarkResult {
+	let items = max(1, Int(Double(count) * benchmark.scale))
+	
+	// Storage is reserved up front so recording doesn't add allocations to the measured period
+	var latencies = Array<UInt64>()
+	latencies.reserveCapacity(items * 2)
+	let drive = benchmark.build(context) { t in
+		latencies.append(now() - t)
+	}
+	
+	let allocationsBefore = AllocationCounter.count
+	let bytesBefore = AllocationCounter.bytes
+	let start = now()
+	drive(items)
+	let seconds = 1e-9 * Double(now() - start)
+	let allocationsAfter = AllocationCounter.count
+	let bytesAfter = AllocationCounter.bytes
+	
+	latencies.sort()
+	func percentile(_ p: Double) -> Double {
+		guard !latencies.isEmpty else { return 0 }
+		return Double(latencies[min(latencies.count - 1, Int(Double(latencies.count) * p))])
+	}
+	
+	let allocations = allocationsBefore.flatMap { before in allocationsAfter.map { after in Double(after - before) / Double(items) } }
+	let bytes = bytesBefore.flatMap { before in bytesAfter.map { after in Double(after - before) / Double(items) } }
+	return BenchmarkResult(benchmark: benchmark.name, context: contextName, items: items, outputs: latencies.count, seconds: seconds, itemsPerSecond: Double(items) / seconds, p50: percentile(0.5), p99: percentile(0.99), p999: percentile(0.999), allocationsPerItem: allocations, bytesPerItem: bytes)
+}
+
+/// Counts Swift heap allocations (class instances, closure contexts and collection storage) by interposing on the Swift runtime's `_swift_allocObject` hook. If the runtime doesn't export the hook, allocations are not counted.
+enum AllocationCounter {
+	/// Installs the counting hook. Must be invoked before any benchmark runs and at most once.
+	///
+	/// - Returns: true if allocations will be counted
+	static func install() -> Bool {
+		#if os(Linux)
+			let handle: UnsafeMutableRawPointer? = nil
+		#else
+			let handle = UnsafeMutableRawPointer(bitPattern: -2) // RTLD_DEFAULT
+		#endif
+		guard pthread_key_create(&allocationsKey, nil) == 0 else { return false }
+		guard let symbol = dlsym(handle, "_swift_allocObject") else { return false }
+		let hook = symbol.assumingMemoryBound(to: Optional<AllocObjectFunction>.self)
+		guard let original = hook.pointee else { return false }
+		originalAllocObject = original
+		hook.pointee = countingAllocObject
+		installed = true
+		return true
+	}
+	
+	/// The number of allocations since `install`, or `nil` if not installed. Threads update their own totals without synchronization so this should be read only when the benchmark's threads are idle.
+	static var count: Int? {
+		guard installed else { return nil }
+		return totalAllocations().count
+	}
+	
+	/// The total size requested by allocations since `install`, or `nil` if not installed. The same caveat as `count` applies.
+	static var bytes: Int? {
+		guard installed else { return nil }
+		return totalAllocations().bytes
+	}
+	
+	private static var installed = false
+}
+
+// Each thread counts into its own `malloc`ed slot (found through a pthread key) so the hook never contends with other threads. Slots are linked into a list, under a mutex, only when a thread first allocates and are never freed, so totals from exited threads are retained.
+private struct ThreadAllocations {
+	var count: Int
+	var bytes: Int
+	let next: UnsafeMutablePointer<ThreadAllocations>?
+}
+
+private typealias AllocObjectFunction = @convention(c) (UnsafeRawPointer, Int, Int) -> UnsafeMutableRawPointer
+private var originalAllocObject: AllocObjectFunction? = nil
+private var allocationsKey = pthread_key_t()
+private var registeredAllocations: UnsafeMutablePointer<ThreadAllocations>? = nil
+private var registrationMutex = AdaptiveMutex.MutexPrimitive()
+private let countingAllocObject: AllocObjectFunction = { metadata, size, alignmentMask in
+	let slot = threadAllocations()
+	slot.pointee.count += 1
+	slot.pointee.bytes += size
+	return originalAllocObject!(metadata, size, alignmentMask)
+}
+
+// Invoked from within the hook, so this must not allocate Swift objects
+private func threadAllocations() -> UnsafeMutablePointer<ThreadAllocations> {
+	if let existing = pthread_getspecific(allocationsKey) {
+		return existing.assumingMemoryBound(to: ThreadAllocations.self)
+	}
+	let slot = malloc(MemoryLayout<ThreadAllocations>.stride)!.bindMemory(to: ThreadAllocations.self, capacity: 1)
+	AdaptiveMutex.lock(&registrationMutex, spinCount: AdaptiveMutex.defaultSpinCount)
+	slot.initialize(to: ThreadAllocations(count: 0, bytes: 0, next: registeredAllocations))
+	registeredAllocations = slot
+	AdaptiveMutex.unlock(&registrationMutex)
+	pthread_setspecific(allocationsKey, slot)
+	return slot
+}
+
+private func totalAllocations() -> (count: Int, bytes: Int) {
+	AdaptiveMutex.lock(&registrationMutex, spinCount: AdaptiveMutex.defaultSpinCount)
+	defer { AdaptiveMutex.unlock(&registrationMutex) }
+	var total = (count: 0, bytes: 0)
+	var slot = registeredAllocations
+	while let s = slot {
+		total.count += s.pointee.count
+		total.bytes += s.pointee.bytes
+		slot = s.pointee.next
+	}
+	return total
+}
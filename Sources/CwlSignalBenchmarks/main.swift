@@ -0,0 +1,72 @@
+//
+//  main.swift
+//  CwlSignalBenchmarks
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import CwlUtils
+
+// Usage: CwlSignalBenchmarks [--count N] [--filter NAME] [--json]
+//
+// Runs every benchmark case in every context. A table is printed by default; with `--json`, an array of `BenchmarkResult` is printed instead so results can be compared across releases. Build with `-c release` for meaningful numbers.
+
+var count = 100_000
+var filter: String? = nil
+var json = false
+
+var arguments = CommandLine.arguments.dropFirst().makeIterator()
+while let argument = arguments.next() {
+	switch argument {
+	case "--count": count = arguments.next().flatMap { Int($0) } ?? count
+	case "--filter": filter = arguments.next()
+	case "--json": json = true
+	default:
+		FileHandle.standardError.write("Unknown argument: \(argument)\nUsage: CwlSignalBenchmarks [--count N] [--filter NAME] [--json]\n".data(using: .utf8)!)
+		exit(1)
+	}
+}
+
+let contexts: Array<(name: String, context: Exec)> = [
+	("direct", .direct),
+	("syncQueue", Exec.syncQueue()),
+	("asyncQueue", Exec.asyncQueue())
+]
+
+if !AllocationCounter.install() {
+	FileHandle.standardError.write("Allocation counting is unavailable with this Swift runtime.\n".data(using: .utf8)!)
+}
+
+var results = Array<BenchmarkResult>()
+for benchmark in benchmarkCases where filter == nil || benchmark.name == filter {
+	for (name, context) in contexts {
+		let result = run(benchmark, context: context, contextName: name, count: count)
+		results.append(result)
+		if !json {
+			let allocations = result.allocationsPerItem.map { String(format: "%.2f", $0) } ?? "-"
+			let bytes = result.bytesPerItem.map { String(format: "%.0f", $0) } ?? "-"
+			let label = benchmark.name.padding(toLength: 16, withPad: " ", startingAt: 0) + name.padding(toLength: 12, withPad: " ", startingAt: 0)
+			print(label + String(format: "%10.0f items/s   p50 %8.0f ns   p99 %8.0f ns   p999 %8.0f ns   allocs/item ", result.itemsPerSecond, result.p50, result.p99, result.p999) + allocations + "   bytes/item " + bytes)
+		}
+	}
+}
+
+if json {
+	let encoder = JSONEncoder()
+	encoder.outputFormatting = .prettyPrinted
+	print(String(data: try! encoder.encode(results), encoding: .utf8)!)
+}
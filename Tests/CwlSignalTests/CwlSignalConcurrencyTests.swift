@@ -0,0 +1,199 @@
+//
+//  CwlSignalConcurrencyTests.swift
+//  CwlSignal
+//
+//  Created by agent on 2026/10/14.
+//  Copyright © 2026 Matt Gallagher ( https://www.cocoawithlove.com ). All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+//  SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR
+//  IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+import Foundation
+import XCTest
+import CwlSignal
+
+#if SWIFT_PACKAGE
+import CwlUtils
+#endif
+
+#if compiler(>=5.7)
+
+private enum TestError: Error {
+	case zeroValue
+	case oneValue
+	case twoValue
+}
+
+@available(OSX 10.15, iOS 13, tvOS 13, watchOS 6, *)
+class SignalConcurrencyTests: XCTestCase {
+	func testValues() async throws {
+		var results = [Int]()
+		for try await v in Signal<Int>.just(1, 3, 5, 7, 11).values() {
+			results.append(v)
+		}
+		XCTAssert(results == [1, 3, 5, 7, 11])
+	}
+	
+	func testValuesError() async {
+		var results = [Int]()
+		var caught: Error? = nil
+		do {
+			for try await v in Signal<Int>.from([1, 3], end: .other(TestError.oneValue)).values() {
+				results.append(v)
+			}
+		} catch {
+			caught = error
+		}
+		XCTAssert(results == [1, 3])
+		XCTAssert(caught as? TestError == .oneValue)
+	}
+	
+	func testValuesBufferingPolicy() async throws {
+		let (input1, signal1) = Signal<Int>.create()
+		let newest = signal1.values(bufferingPolicy: .bufferingNewest(2))
+		input1.send(1, 2, 3, 4)
+		input1.complete()
+		var results1 = [Int]()
+		for try await v in newest {
+			results1.append(v)
+		}
+		XCTAssert(results1 == [3, 4])
+		
+		let (input2, signal2) = Signal<Int>.create()
+		let oldest = signal2.values(bufferingPolicy: .bufferingOldest(2))
+		input2.send(1, 2, 3, 4)
+		input2.complete()
+		var results2 = [Int]()
+		for try await v in oldest {
+			results2.append(v)
+		}
+		XCTAssert(results2 == [1, 2])
+		XCTAssert(oldest.end?.isComplete == true)
+	}
+	
+	func testValuesSuspendsUntilSent() async throws {
+		let (input, signal) = Signal<Int>.create()
+		let values = signal.values()
+		let task = Task { () -> [Int] in
+			var results = [Int]()
+			for try await v in values {
+				results.append(v)
+			}
+			return results
+		}
+		DispatchQueue.global().asyncAfter(deadline: .now() + .milliseconds(10)) {
+			for i in 0..<100 {
+				input.send(i)
+			}
+			input.complete()
+		}
+		let results = try await task.value
+		XCTAssert(results == Array(0..<100))
+	}
+	
+	func testValuesTaskCancellation() async throws {
+		let (input, signal) = Signal<Int>.create()
+		let values = signal.values()
+		let task = Task { () -> Int in
+			var count = 0
+			for try await _ in values {
+				count += 1
+			}
+			return count
+		}
+		task.cancel()
+		let count = try await task.value
+		XCTAssert(count == 0)
+		XCTAssert(values.end?.isCancelled == true)
+		withExtendedLifetime(input) {}
+	}
+	
+	func testBoundedInput() async throws {
+		let (input, signal) = Signal<Int>.create()
+		
+		// Delivery of the first value blocks until released, so the producer must suspend once `capacity` values are outstanding
+		let gate = DispatchSemaphore(value: 0)
+		let values = signal.map { v -> Int in
+			if v == 0 {
+				gate.wait()
+			}
+			return v
+		}.values()
+		let bounded = input.bounded(capacity: 4)
+		let mutex = PThreadMutex()
+		var sent = 0
+		let producer = Task {
+			for i in 0..<1000 {
+				await bounded.send(i)
+				mutex.sync { sent += 1 }
+			}
+			await bounded.complete()
+		}
+		while mutex.sync(execute: { sent }) < 4 {
+			try await Task.sleep(nanoseconds: 1_000_000)
+		}
+		try await Task.sleep(nanoseconds: 50_000_000)
+		XCTAssert(mutex.sync { sent } == 4)
+		gate.signal()
+		
+		var results = [Int]()
+		for try await v in values {
+			results.append(v)
+		}
+		await producer.value
+		XCTAssert(results == Array(0..<1000))
+	}
+}
+
+#endif
+
+#if compiler(>=5.9)
+
+@available(OSX 14, iOS 17, tvOS 17, watchOS 10, *)
+private actor Accumulator {
+	let executor: SignalSerialExecutor
+	var values = [Int]()
+	
+	init(executor: SignalSerialExecutor) {
+		self.executor = executor
+	}
+	
+	nonisolated var unownedExecutor: UnownedSerialExecutor {
+		return executor.asUnownedSerialExecutor()
+	}
+	
+	func append(_ value: Int) {
+		values.append(value)
+	}
+}
+
+@available(OSX 14, iOS 17, tvOS 17, watchOS 10, *)
+class SignalSerialExecutorTests: XCTestCase {
+	func testActorIsolatedHandler() async {
+		let executor = SignalSerialExecutor()
+		let accumulator = Accumulator(executor: executor)
+		let ex = expectation(description: "Values received")
+		let out = Signal<Int>.just(1, 3, 5, 7, 11).subscribe(context: .custom(executor)) { r in
+			switch r {
+			case .success(let v): accumulator.assumeIsolated { $0.append(v) }
+			case .failure: ex.fulfill()
+			}
+		}
+		await fulfillment(of: [ex], timeout: 1e1)
+		let values = await accumulator.values
+		XCTAssert(values == [1, 3, 5, 7, 11])
+		withExtendedLifetime(out) {}
+	}
+}
+
+#endif
@@ -84,6 +84,37 @@ class SignalReactiveTests: XCTestCase {
 		XCTAssert(sequence.end?.isCancelled == true)
 	}
 	
+	func testToSequenceBatch() {
+		let (input, signal) = Signal<Int>.create()
+		let sequence = signal.toSequence()
+		input.send(1, 2, 3, 4, 5)
+		
+		XCTAssert(sequence.nextBatch(max: 2) == [1, 2])
+		XCTAssert(sequence.nextBatch() == [3, 4, 5])
+		XCTAssert(sequence.end == nil)
+		
+		input.send(6)
+		input.complete()
+		XCTAssert(sequence.nextBatch() == [6])
+		XCTAssert(sequence.nextBatch() == nil)
+		XCTAssert(sequence.next() == nil)
+		XCTAssert(sequence.end?.isComplete == true)
+		
+		// Values sent from another thread while the consumer blocks are all delivered, in order
+		let (input2, signal2) = Signal<Int>.create()
+		let sequence2 = signal2.toSequence()
+		DispatchQueue.global().async {
+			for i in 0..<1000 {
+				input2.send(i)
+			}
+			input2.complete()
+		}
+		let batches = Array(sequence2.batches(max: 100))
+		XCTAssert(batches.allSatisfy { !$0.isEmpty && $0.count <= 100 })
+		XCTAssert(batches.flatMap { $0 } == Array(0..<1000))
+		XCTAssert(sequence2.end?.isComplete == true)
+	}
+	
 	func testInterval() {
 		var results = [Result<Int, SignalEnd>]()
 		let coordinator = DebugContextCoordinator()
@@ -184,6 +215,156 @@ class SignalReactiveTests: XCTestCase {
 		}
 	}
 	
+	func testBufferCountSkip() {
+		do {
+			// A skip larger than count leaves gaps between buffers
+			var results = [Result<[Int], SignalEnd>]()
+			_ = Signal<Int>.from(1...10).buffer(count: 2, skip: 3).subscribe {
+				results.append($0)
+			}
+			XCTAssert(results.count == 5)
+			XCTAssert(results.at(0)?.value == [1, 2])
+			XCTAssert(results.at(1)?.value == [4, 5])
+			XCTAssert(results.at(2)?.value == [7, 8])
+			XCTAssert(results.at(3)?.value == [10])
+			XCTAssert(results.at(4)?.error?.isComplete == true)
+		}
+		
+		do {
+			// Heavily overlapping buffers with partial buffers emitted in order of their start
+			var results = [Result<[Int], SignalEnd>]()
+			_ = Signal<Int>.from(1...5).buffer(count: 4, skip: 1).subscribe {
+				results.append($0)
+			}
+			XCTAssert(results.compactMap { $0.value } == [[1, 2, 3, 4], [2, 3, 4, 5], [3, 4, 5], [4, 5], [5]])
+			XCTAssert(results.last?.error?.isComplete == true)
+		}
+		
+		do {
+			var results = [Result<[Int], SignalEnd>]()
+			_ = Signal<Int>.from(1...3).buffer(count: 1).subscribe {
+				results.append($0)
+			}
+			XCTAssert(results.compactMap { $0.value } == [[1], [2], [3]])
+			XCTAssert(results.last?.error?.isComplete == true)
+		}
+	}
+	
+	func testBufferRecycleStorage() {
+		do {
+			// Retaining the emitted arrays forces the recycled storage to copy-on-write, so earlier arrays are unaffected
+			var results = [Result<[Int], SignalEnd>]()
+			_ = Signal<Int>.from(1...5).buffer(count: 4, skip: 1, recycleStorage: true).subscribe {
+				results.append($0)
+			}
+			XCTAssert(results.compactMap { $0.value } == [[1, 2, 3, 4], [2, 3, 4, 5], [3, 4, 5], [4, 5], [5]])
+			XCTAssert(results.last?.error?.isComplete == true)
+		}
+		
+		do {
+			// Arrays released by the receiver are reused
+			var sums = [Int]()
+			_ = Signal<Int>.from(1...10).buffer(count: 3, recycleStorage: true).subscribeValues {
+				sums.append($0.reduce(0, +))
+			}
+			XCTAssert(sums == [6, 15, 24, 10])
+		}
+		
+		do {
+			var results = [[Int]]()
+			let (input, signal) = Signal<Int>.create()
+			let (boundaryInput, boundaries) = Signal<Void>.create()
+			let out = signal.buffer(boundaries: boundaries, recycleStorage: true).subscribeValues {
+				results.append($0)
+			}
+			input.send(1, 2)
+			boundaryInput.send(())
+			boundaryInput.send(())
+			input.send(3)
+			boundaryInput.send(())
+			input.send(4)
+			input.complete()
+			XCTAssert(results == [[1, 2], [], [3], [4]])
+			withExtendedLifetime(out) {}
+		}
+	}
+	
+	func testCombineLatestSequence() {
+		var results = [[Int]]()
+		let pairs = (0..<1000).map { _ in Signal<Int>.create() }
+		let out = Signal<Int>.combineLatest(sequence: pairs.map { $0.signal }).subscribeValues {
+			results.append($0)
+		}
+		for (i, p) in pairs.enumerated().dropLast() {
+			p.input.send(i)
+			p.input.send(i + 1)
+		}
+		XCTAssert(results.isEmpty)
+		pairs.last?.input.send(0)
+		pairs[3].input.send(-3)
+		pairs[999].input.send(-999)
+		XCTAssert(results.count == 3)
+		XCTAssert(results.at(0) == (0..<999).map { $0 + 1 } + [0])
+		XCTAssert(results.at(1)?[3] == -3)
+		XCTAssert(results.at(1)?[999] == 0)
+		
+		// Earlier emissions are unchanged by later updates
+		XCTAssert(results.at(0)?[3] == 4)
+		XCTAssert(results.at(2)?[3] == -3)
+		XCTAssert(results.at(2)?[999] == -999)
+		withExtendedLifetime(out) {}
+	}
+	
+	func testCombineLatestSequenceCoalesce() {
+		let pairs = (0..<10).map { _ in Signal<Int>.create() }
+		let blocker = DispatchSemaphore(value: 0)
+		let ex = expectation(description: "Latest values received")
+		var results = [[Int]]()
+		let out = Signal<Int>.combineLatest(sequence: pairs.map { $0.signal }, coalesce: true).subscribeValues(context: .global) { v in
+			if results.isEmpty {
+				blocker.wait()
+			}
+			results.append(v)
+			if v == Array(repeating: 100, count: 10) {
+				ex.fulfill()
+			}
+		}
+		for p in pairs {
+			p.input.send(0)
+		}
+		
+		// While the first emission is blocked, a burst of updates coalesces into a single queued array
+		for i in 1...100 {
+			for p in pairs {
+				p.input.send(i)
+			}
+		}
+		blocker.signal()
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(results.count == 2)
+		XCTAssert(results.first == Array(repeating: 0, count: 10))
+		withExtendedLifetime(out) {}
+	}
+	
+	func testZipLeading() {
+		// One side running far ahead of the other must still pair values in order
+		var results = [Int]()
+		let (input1, signal1) = Signal<Int>.create()
+		let (input2, signal2) = Signal<Int>.create()
+		let out = signal1.zip(signal2).subscribeValues { v in
+			XCTAssert(v.0 == v.1)
+			results.append(v.0)
+		}
+		for i in 0..<10_000 {
+			input1.send(value: i)
+		}
+		for i in 0..<10_000 {
+			input2.send(value: i)
+		}
+		XCTAssert(results == Array(0..<10_000))
+		withExtendedLifetime(out) {}
+	}
+	
 	func testBufferSeconds() {
 		var results = [Result<[Int], SignalEnd>]()
 		let coordinator = DebugContextCoordinator()
@@ -501,6 +682,41 @@ class SignalReactiveTests: XCTestCase {
 		withExtendedLifetime(output) {}
 	}
 	
+	func testFlatMapLatestMulti() {
+		// Each inner signal is a `SignalMulti` with another subscriber, which must remain connected when `flatMapLatest` switches away
+		var results = [Result<Int, SignalEnd>]()
+		var others = [Int]()
+		let pairs = [Signal<Int>.create(), Signal<Int>.create()]
+		let multis = pairs.map { $0.signal.multicast() }
+		let otherOutputs = multis.map { $0.subscribeValues { others.append($0) } }
+		let wrapper = Signal<Int>.create()
+		let output = wrapper.signal.flatMapLatest { v in multis[v] }.subscribe { r in
+			results.append(r)
+		}
+		
+		wrapper.input.send(0)
+		pairs[0].input.send(0, 1)
+		wrapper.input.send(1)
+		pairs[0].input.send(2)
+		pairs[1].input.send(3)
+		wrapper.input.send(0)
+		pairs[0].input.send(4)
+		pairs[1].input.send(5)
+		wrapper.input.complete()
+		pairs.forEach { $0.input.complete() }
+		
+		XCTAssert(results.count == 5)
+		XCTAssert(results.at(0)?.value == 0)
+		XCTAssert(results.at(1)?.value == 1)
+		XCTAssert(results.at(2)?.value == 3)
+		XCTAssert(results.at(3)?.value == 4)
+		XCTAssert(results.at(4)?.error?.isComplete == true)
+		XCTAssert(others == [0, 1, 2, 3, 4, 5])
+		
+		withExtendedLifetime(output) {}
+		withExtendedLifetime(otherOutputs) {}
+	}
+	
 	func testConcatMap() {
 		var results = [Result<String, SignalEnd>]()
 		let inputOutputPairs = (0..<4).map { i in Signal<String>.create() }
@@ -616,6 +832,79 @@ class SignalReactiveTests: XCTestCase {
 		XCTAssert(r3?.at(7)?.error?.isComplete == true)
 	}
 	
+	func testGroupByEvictAfterIdle() {
+		var keys = [Int]()
+		var results = [Array<Result<Int, SignalEnd>>]()
+		let coordinator = DebugContextCoordinator()
+		let (input, signal) = Signal<Int>.create()
+		var delayedInputs = [Lifetime]()
+		let inputs: [(delay: Int, value: Int)] = [(4, 10), (4, 20), (8, 11), (30, 21), (55, 22), (90, 12)]
+		for i in inputs {
+			delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(i.delay)) {
+				input.send(value: i.value)
+			})
+		}
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(100)) {
+			coordinator.stop()
+		})
+		
+		let out = signal.groupBy(evictAfterIdle: .milliseconds(20), context: coordinator.direct) { v in v / 10 }.subscribe { r in
+			if let v = r.value {
+				let index = results.count
+				keys.append(v.0)
+				results.append([])
+				v.1.subscribeUntilEnd { r in
+					results[index].append(r)
+				}
+			}
+		}
+		
+		coordinator.runScheduledTasks()
+		withExtendedLifetime(out) { }
+		withExtendedLifetime(delayedInputs) { }
+		
+		// Key 1 is idle from 8ms and evicted by the 40ms tick, key 2 is idle from 55ms and evicted by the 80ms tick, then key 1 starts a new group
+		XCTAssert(keys == [1, 2, 1])
+		XCTAssert(results.at(0)?.compactMap { $0.value } == [10, 11])
+		XCTAssert(results.at(0)?.last?.error?.isComplete == true)
+		XCTAssert(results.at(1)?.compactMap { $0.value } == [20, 21, 22])
+		XCTAssert(results.at(1)?.last?.error?.isComplete == true)
+		XCTAssert(results.at(2)?.count == 1)
+		XCTAssert(results.at(2)?.at(0)?.value == 12)
+	}
+	
+	func testPartition() {
+		let ex = expectation(description: "Waiting for all partitions to complete")
+		let queue = DispatchQueue(label: "")
+		var results = Dictionary<Int, Array<Int>>()
+		var completed = 0
+		_ = Signal.from(0..<1000).partition(by: { v in v % 10 }, shards: 4).subscribe { r in
+			guard let v = r.value else { return }
+			v.1.subscribeUntilEnd { r in
+				queue.sync {
+					switch r {
+					case .success(let value): results[v.0, default: []].append(value)
+					case .failure(let e):
+						XCTAssert(e.isComplete)
+						completed += 1
+						if completed == 10 {
+							ex.fulfill()
+						}
+					}
+				}
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		
+		queue.sync {
+			XCTAssert(results.count == 10)
+			for (key, values) in results {
+				// Values for each key must arrive complete and in order, even though keys are delivered across shards
+				XCTAssert(values == Array(stride(from: key, to: 1000, by: 10)))
+			}
+		}
+	}
+	
 	func testCompactOptionals() {
 		var results = [Result<Int, SignalEnd>]()
 		_ = Signal<Int?>.just(1, nil, 2, nil).compact().subscribe { r in results.append(r) }
@@ -652,6 +941,87 @@ class SignalReactiveTests: XCTestCase {
 		XCTAssert(results.at(5)?.error?.isComplete == true)
 	}
 	
+	func testConcurrentMap() {
+		let ex = expectation(description: "Waiting for concurrentMap to complete")
+		let queue = DispatchQueue(label: "")
+		var results = [Result<Int, SignalEnd>]()
+		var maxInFlight = 0
+		var inFlight = 0
+		let out = Signal.from(0..<50).concurrentMap(maxConcurrency: 4) { (v: Int) -> Int in
+			queue.sync {
+				inFlight += 1
+				maxInFlight = max(maxInFlight, inFlight)
+			}
+			// Earlier values take longer so that completion order is the reverse of input order within each batch
+			usleep(UInt32((4 - v % 4) * 500))
+			queue.sync { inFlight -= 1 }
+			return v * 2
+		}.subscribe { r in
+			queue.sync { results.append(r) }
+			if r.isFailure {
+				ex.fulfill()
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(out) { }
+		
+		queue.sync {
+			XCTAssert(results.count == 51)
+			XCTAssert(results.compactMap { $0.value } == (0..<50).map { $0 * 2 })
+			XCTAssert(results.last?.error?.isComplete == true)
+			XCTAssert(maxInFlight <= 4)
+		}
+	}
+	
+	func testConcurrentMapUnordered() {
+		let ex = expectation(description: "Waiting for concurrentMap to complete")
+		let queue = DispatchQueue(label: "")
+		var results = [Result<Int, SignalEnd>]()
+		let out = Signal.from(0..<50).concurrentMap(maxConcurrency: 4, preservingOrder: false) { (v: Int) -> Int in
+			usleep(UInt32((4 - v % 4) * 500))
+			return v * 2
+		}.subscribe { r in
+			queue.sync { results.append(r) }
+			if r.isFailure {
+				ex.fulfill()
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(out) { }
+		
+		queue.sync {
+			XCTAssert(results.count == 51)
+			XCTAssert(results.compactMap { $0.value }.sorted() == (0..<50).map { $0 * 2 })
+			XCTAssert(results.last?.error?.isComplete == true)
+		}
+	}
+	
+	func testConcurrentMapError() {
+		let ex = expectation(description: "Waiting for concurrentMap to complete")
+		let queue = DispatchQueue(label: "")
+		var results = [Result<Int, SignalEnd>]()
+		let out = Signal.from(0..<20).concurrentMap(maxConcurrency: 4) { (v: Int) -> Int in
+			if v == 10 {
+				throw TestError.oneValue
+			}
+			return v
+		}.subscribe { r in
+			queue.sync { results.append(r) }
+			if r.isFailure {
+				ex.fulfill()
+			}
+		}
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(out) { }
+		
+		// The error takes the place of value 10 and no later values are emitted
+		queue.sync {
+			XCTAssert(results.count == 11)
+			XCTAssert(results.compactMap { $0.value } == Array(0..<10))
+			XCTAssert(results.last?.error?.otherError as? TestError == TestError.oneValue)
+		}
+	}
+	
 	func testMapActivation() {
 		var results = [Result<Int, SignalEnd>]()
 		let (input, signal) = Signal<Int>.create()
@@ -1086,6 +1456,77 @@ class SignalReactiveTests: XCTestCase {
 		XCTAssert(results.at(5)?.error?.isComplete == true)
 	}
 	
+	func testDebounceFlushOnClose() {
+		var results = [Result<Int, SignalEnd>]()
+		let coordinator = DebugContextCoordinator()
+		let (input, signal) = Signal<Int>.create()
+		var delayedInputs = [Lifetime]()
+		let delays: [Int] = [4, 8, 12, 60, 64]
+		for i in 0..<delays.count {
+			delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(delays[i])) {
+				input.send(value: i)
+			})
+		}
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(70)) {
+			input.complete()
+		})
+		
+		let out = signal.debounce(interval: .interval(0.02), flushOnClose: true, context: coordinator.direct).subscribe { r in
+			results.append(r)
+		}
+		
+		coordinator.runScheduledTasks()
+		withExtendedLifetime(out) { }
+		withExtendedLifetime(delayedInputs) { }
+		
+		// The value pending at close is emitted immediately before the close
+		XCTAssert(results.count == 3)
+		XCTAssert(results.at(0)?.value == 2)
+		XCTAssert(results.at(1)?.value == 4)
+		XCTAssert(results.at(2)?.error?.isComplete == true)
+	}
+	
+	func testDebounceReactivation() {
+		var results = [Result<Int, SignalEnd>]()
+		let coordinator = DebugContextCoordinator()
+		let (input, signal) = Signal<Int>.create()
+		let junction = signal.debounce(interval: .interval(0.02), context: coordinator.direct).junction()
+		let (junctionInput, output) = Signal<Int>.create()
+		try! junction.bind(to: junctionInput)
+		let out = output.subscribe { r in results.append(r) }
+		
+		// The value pending when the graph is deactivated must not be emitted after reactivation
+		var delayedInputs = [Lifetime]()
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(4)) { input.send(value: 1) })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(10)) { junction.rebind() })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(60)) { input.send(value: 2) })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(120)) { coordinator.stop() })
+		
+		coordinator.runScheduledTasks()
+		withExtendedLifetime(out) { }
+		withExtendedLifetime(delayedInputs) { }
+		
+		XCTAssert(results.count == 1)
+		XCTAssert(results.at(0)?.value == 2)
+	}
+	
+	func testDebounceDispatchTimers() {
+		// Without a debug context, debounce runs on the shared timer wheel
+		let ex = expectation(description: "Waiting for debounced value")
+		var results = [Result<Int, SignalEnd>]()
+		let (input, signal) = Signal<Int>.create()
+		let out = signal.debounce(interval: .milliseconds(20)).subscribe { r in
+			results.append(r)
+			ex.fulfill()
+		}
+		input.send(1, 2, 3)
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(results.count == 1)
+		XCTAssert(results.at(0)?.value == 3)
+		withExtendedLifetime(out) { }
+		withExtendedLifetime(input) { }
+	}
+	
 	func testThrottleFirst() {
 		var results = [Result<Int, SignalEnd>]()
 		let coordinator = DebugContextCoordinator()
@@ -1118,6 +1559,32 @@ class SignalReactiveTests: XCTestCase {
 		XCTAssert(results.at(5)?.error?.isComplete == true)
 	}
 	
+	func testThrottleFirstReactivation() {
+		var results = [Result<Int, SignalEnd>]()
+		let coordinator = DebugContextCoordinator()
+		let (input, signal) = Signal<Int>.create()
+		let junction = signal.throttleFirst(interval: .interval(0.02), context: coordinator.direct).junction()
+		let (junctionInput, output) = Signal<Int>.create()
+		try! junction.bind(to: junctionInput)
+		let out = output.subscribe { r in results.append(r) }
+		
+		// The throttle interval started in the previous activation must not drop the first value after reactivation
+		var delayedInputs = [Lifetime]()
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(4)) { input.send(value: 1) })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(10)) { junction.rebind() })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(12)) { input.send(value: 2) })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(16)) { input.send(value: 3) })
+		delayedInputs.append(coordinator.main.singleTimer(interval: .milliseconds(60)) { coordinator.stop() })
+		
+		coordinator.runScheduledTasks()
+		withExtendedLifetime(out) { }
+		withExtendedLifetime(delayedInputs) { }
+		
+		XCTAssert(results.count == 2)
+		XCTAssert(results.at(0)?.value == 1)
+		XCTAssert(results.at(1)?.value == 2)
+	}
+	
 	func testDistinct() {
 		var results = [Result<Int, SignalEnd>]()
 		_ = Signal.just(0, 0, 1, 2, 3, 5, 5, 1, 0, 2, 7, 5).distinct().subscribe { (r: Result<Int, SignalEnd>) -> Void in
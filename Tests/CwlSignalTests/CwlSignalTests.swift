@@ -423,6 +423,56 @@ class SignalTests: XCTestCase {
 		withExtendedLifetime(ep3) {}
 	}
 	
+	
+	func testSignalPlaybackCapacity() {
+		let (input, s) = Signal<Int>.create()
+		let signal = s.playback(capacity: 2)
+		input.send(1, 2, 3, 4, 5)
+		
+		// Only the most recent values are retained
+		var results1 = [Int]()
+		let ep1 = signal.subscribeValues { v in results1.append(v) }
+		XCTAssert(results1 == [4, 5])
+		
+		input.send(value: 6)
+		XCTAssert(results1 == [4, 5, 6])
+		
+		var results2 = [Result<Int, SignalEnd>]()
+		let ep2 = signal.subscribe { r in results2.append(r) }
+		XCTAssert(results2.compactMap { $0.value } == [5, 6])
+		
+		// The end is retained in addition to the values
+		input.complete()
+		var results3 = [Result<Int, SignalEnd>]()
+		let ep3 = signal.subscribe { r in results3.append(r) }
+		XCTAssert(results3.compactMap { $0.value } == [5, 6])
+		XCTAssert(results3.last?.error?.isComplete == true)
+		XCTAssert(results1 == [4, 5, 6])
+		
+		withExtendedLifetime(ep1) {}
+		withExtendedLifetime(ep2) {}
+		withExtendedLifetime(ep3) {}
+	}
+	
+	func testSignalPlaybackWindow() {
+		let (input, s) = Signal<Int>.create()
+		let signal = s.playback(window: .seconds(3600))
+		input.send(1, 2, 3)
+		
+		var results1 = [Int]()
+		let ep1 = signal.subscribeValues { v in results1.append(v) }
+		XCTAssert(results1 == [1, 2, 3])
+		
+		input.send(value: 4)
+		var results2 = [Int]()
+		let ep2 = signal.subscribeValues { v in results2.append(v) }
+		XCTAssert(results1 == [1, 2, 3, 4])
+		XCTAssert(results2 == [1, 2, 3, 4])
+		
+		withExtendedLifetime(ep1) {}
+		withExtendedLifetime(ep2) {}
+	}
+	
 	func testSignalCacheUntilActive() {
 		// Create a signal
 		let (input, s) = Signal<Int>.create()
@@ -1370,6 +1420,281 @@ class SignalTests: XCTestCase {
 		XCTAssert(results.at(0)?.value == 5)
 	}
 	
+	func testSendContentsOf() {
+		var results = Array<Result<Int, SignalEnd>>()
+		var input: SignalInput<Int>? = nil
+		let (i, out) = Signal<Int>.create { $0.map { $0 * 2 }.subscribe { r in
+			results.append(r)
+			
+			// A re-entrant batch is queued behind the values already queued
+			if r.value == 10 {
+				input?.send(contentsOf: [.success(6), .success(7)])
+			}
+		} }
+		input = i
+		XCTAssert(i.send(contentsOf: [.success(1), .success(2), .success(3)]) == nil)
+		XCTAssert(results.compactMap { $0.value } == [2, 4, 6])
+		
+		i.send(contentsOf: [.success(4), .success(5), .success(8)])
+		XCTAssert(results.compactMap { $0.value } == [2, 4, 6, 8, 10, 16, 12, 14])
+		
+		// An error in the batch closes the signal and the remainder of the batch is discarded
+		i.send(contentsOf: [.success(9), .failure(.complete), .success(11)])
+		XCTAssert(results.count == 10)
+		XCTAssert(results.at(8)?.value == 18)
+		XCTAssert(results.at(9)?.error?.isComplete == true)
+		XCTAssert(i.send(contentsOf: [.success(12), .success(13)]) == SignalSendError.disconnected)
+		withExtendedLifetime(out) {}
+		
+		// Batches sent to a `SignalMultiInput` are sent through a single new input per batch
+		var multiResults = Array<Int>()
+		let multi = Signal<Int>.multiChannel().subscribeValues { v in multiResults.append(v) }
+		multi.input.send(1, 2, 3)
+		multi.input.send(sequence: 4...6)
+		XCTAssert(multiResults == [1, 2, 3, 4, 5, 6])
+	}
+	
+	func testTransformFusion() {
+		// A chain of `.direct` transformations, including stateful transformations, that is fused into a single processor
+		var results = Array<Result<Int, SignalEnd>>()
+		let (input, signal) = Signal<Int>.create()
+		let intermediate = signal.map { $0 + 1 }
+		let out = intermediate.filter { $0 % 2 == 0 }.compactMap { $0 > 2 ? $0 : nil }.map(initialState: 0) { (s: inout Int, v: Int) -> Int in
+			s += v
+			return s
+		}.transform { (r: Result<Int, SignalEnd>) -> Signal<Int>.Next in
+			switch r {
+			case .success(let v): return .array([.success(v), .success(-v)])
+			case .failure(let e): return .end(e)
+			}
+		}.junction()
+		
+		let (input1, signal1) = Signal<Int>.create()
+		let ep1 = signal1.subscribe { r in results.append(r) }
+		try! out.bind(to: input1)
+		input.send(1, 2, 3, 4, 5)
+		XCTAssert(results.compactMap { $0.value } == [4, -4, 10, -10])
+		
+		// The intermediate `Signal` already has a successor, so attaching another is an error
+		let e = catchBadInstruction {
+			_ = intermediate.subscribe { _ in }
+			XCTFail()
+		}
+		XCTAssert(e != nil)
+		
+		// State in the fused stages is reset when the graph is reactivated
+		_ = out.disconnect()
+		results.removeAll()
+		let (input2, signal2) = Signal<Int>.create()
+		let ep2 = signal2.subscribe { r in results.append(r) }
+		try! out.bind(to: input2)
+		input.send(5)
+		XCTAssert(results.compactMap { $0.value } == [6, -6])
+		
+		// An end in the middle of an array passes through the fused stages and the remainder is discarded
+		var arrayResults = Array<Result<Int, SignalEnd>>()
+		let (arrayInput, arraySignal) = Signal<Int>.create()
+		let arrayEp = arraySignal.transform { (r: Result<Int, SignalEnd>) -> Signal<Int>.Next in
+			switch r {
+			case .success(let v): return .array([.success(v), .failure(.complete), .success(v + 1)])
+			case .failure(let e): return .end(e)
+			}
+		}.map { $0 * 10 }.subscribe { r in arrayResults.append(r) }
+		arrayInput.send(1)
+		XCTAssert(arrayResults.count == 2)
+		XCTAssert(arrayResults.at(0)?.value == 10)
+		XCTAssert(arrayResults.at(1)?.error?.isComplete == true)
+		
+		// Transformations on a non-direct context are not fused but still deliver correctly
+		var asyncResults = Array<Int>()
+		let ex = expectation(description: "Waiting for async context")
+		let (asyncInput, asyncSignal) = Signal<Int>.create()
+		let asyncEp = asyncSignal.map { $0 + 1 }.map(context: .global) { $0 * 2 }.map { $0 + 1 }.subscribe(context: .main) { r in
+			switch r {
+			case .success(let v): asyncResults.append(v)
+			case .failure: ex.fulfill()
+			}
+		}
+		asyncInput.send(1, 2)
+		asyncInput.complete()
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(asyncResults == [5, 7])
+		
+		withExtendedLifetime(ep1) {}
+		withExtendedLifetime(ep2) {}
+		withExtendedLifetime(arrayEp) {}
+		withExtendedLifetime(asyncEp) {}
+	}
+	
+	func testBoundedQueue() {
+		func run(_ policy: SignalQueuePolicy) -> (values: Array<Int>, ended: Bool) {
+			var values = Array<Int>()
+			var ended = false
+			let processing = DispatchSemaphore(value: 0)
+			let resume = DispatchSemaphore(value: 0)
+			let ex = expectation(description: "Waiting for end")
+			let (input, signal) = Signal<Int>.create()
+			let out = signal.bounded(capacity: 2, policy: policy).subscribe(context: .global) { r in
+				switch r {
+				case .success(let v):
+					values.append(v)
+					if v == 0 {
+						processing.signal()
+						resume.wait()
+					}
+				case .failure:
+					ended = true
+					ex.fulfill()
+				}
+			}
+			
+			// Values sent while the first value is processed are queued by the bounded signal
+			input.send(value: 0)
+			processing.wait()
+			for n in 1...5 {
+				XCTAssert(input.send(value: n) == nil)
+			}
+			input.complete()
+			resume.signal()
+			waitForExpectations(timeout: 1e1, handler: nil)
+			withExtendedLifetime(out) {}
+			return (values, ended)
+		}
+		
+		let dropOldest = run(.dropOldest)
+		XCTAssert(dropOldest.values == [0, 4, 5])
+		XCTAssert(dropOldest.ended)
+		
+		let dropNewest = run(.dropNewest)
+		XCTAssert(dropNewest.values == [0, 1, 2])
+		XCTAssert(dropNewest.ended)
+		
+		let coalesceLatest = run(.coalesceLatest)
+		XCTAssert(coalesceLatest.values == [0, 1, 5])
+		XCTAssert(coalesceLatest.ended)
+		
+		// Activation values are not limited by the capacity
+		var results = Array<Int>()
+		let out = Signal<Int>.preclosed(1, 2, 3, 4).bounded(capacity: 1, policy: .dropNewest).subscribeValues { results.append($0) }
+		XCTAssert(results == [1, 2, 3, 4])
+		withExtendedLifetime(out) {}
+	}
+	
+	func testBoundedInputReject() {
+		var values = Array<Int>()
+		var errors = Array<SignalSendError?>()
+		let processing = DispatchSemaphore(value: 0)
+		let resume = DispatchSemaphore(value: 0)
+		let ex = expectation(description: "Waiting for end")
+		let (input, signal) = Signal<Int>.create(capacity: 2, policy: .reject)
+		let out = signal.subscribe(context: .global) { r in
+			switch r {
+			case .success(let v):
+				values.append(v)
+				if v == 0 {
+					processing.signal()
+					resume.wait()
+				}
+			case .failure: ex.fulfill()
+			}
+		}
+		
+		// The producer sends directly to the bounded signal so it is told when the queue is full
+		input.send(value: 0)
+		processing.wait()
+		for n in 1...5 {
+			errors.append(input.send(value: n))
+		}
+		input.complete()
+		resume.signal()
+		waitForExpectations(timeout: 1e1, handler: nil)
+		withExtendedLifetime(out) {}
+		
+		XCTAssert(values == [0, 1, 2])
+		XCTAssert(errors.map { $0 == SignalSendError.queueFull } == [false, false, true, true, true])
+	}
+	
+	func testFreeze() {
+		// A frozen chain delivers normally
+		var results = Array<Int>()
+		let (input, signal) = Signal<Int>.create()
+		let out = signal.map { $0 * 2 }.filter { $0 > 2 }.freeze().subscribeValues { results.append($0) }
+		input.send(1, 2, 3)
+		XCTAssert(results == [4, 6])
+		
+		// Rewiring a frozen merged input unfreezes it and stale predecessors are still rejected
+		var merged = Array<Int>()
+		let (mergedInput, mergedSignal) = Signal<Int>.createMergedInput()
+		let (input1, signal1) = Signal<Int>.create()
+		let (input2, signal2) = Signal<Int>.create()
+		mergedInput.add(signal1)
+		let out2 = mergedSignal.freeze().subscribeValues { merged.append($0) }
+		input1.send(1)
+		mergedInput.add(signal2)
+		input2.send(2)
+		mergedInput.remove(signal1)
+		input1.send(3)
+		input2.send(4)
+		XCTAssert(merged == [1, 2, 4])
+		
+		// Deactivation of a frozen chain still stops delivery
+		var deactivated = Array<Int>()
+		let (input3, signal3) = Signal<Int>.create()
+		let frozen = signal3.map { $0 }.freeze()
+		var out3: SignalOutput<Int>? = frozen.subscribeValues { deactivated.append($0) }
+		input3.send(1)
+		out3?.cancel()
+		out3 = nil
+		input3.send(2)
+		XCTAssert(deactivated == [1])
+		
+		withExtendedLifetime(out) {}
+		withExtendedLifetime(out2) {}
+	}
+	
+	#if CWLSIGNAL_METRICS
+		func testMetrics() {
+			var results = Array<Int>()
+			var input: SignalInput<Int>? = nil
+			let (i, signal) = Signal<Int>.create()
+			input = i
+			let mapped = signal.map { $0 * 2 }
+			let out = mapped.subscribeValues { v in
+				results.append(v)
+				
+				// A re-entrant send is queued, rather than delivered directly
+				if v == 2 {
+					input?.send(value: 10)
+				}
+			}
+			
+			// The first value of the batch is delivered directly, the remainder are queued
+			i.send(1, 2, 3)
+			XCTAssert(results == [2, 4, 6, 20])
+			
+			let metrics = signal.metrics
+			XCTAssert(metrics.delivered == 4)
+			XCTAssert(metrics.direct == 1)
+			XCTAssert(metrics.queued == 3)
+			XCTAssert(metrics.queueHighWaterMark == 3)
+			
+			// Only one thread was involved, so the mutex was never contended
+			XCTAssert(metrics.contendedLocks == 0)
+			XCTAssert(metrics.failedTryLocks == 0)
+			
+			// The graph snapshot includes both signals, from either end
+			let graph = mapped.graphMetrics()
+			XCTAssert(graph.count == 2)
+			XCTAssert(graph.first?.id == ObjectIdentifier(mapped))
+			XCTAssert(graph.first?.predecessors == [ObjectIdentifier(signal)])
+			XCTAssert(graph.contains { $0.id == ObjectIdentifier(signal) && $0.handlerType?.hasPrefix("SignalTransformer") == true })
+			XCTAssert(signal.graphMetrics().count == 2)
+			
+			withExtendedLifetime(out) {}
+			input = nil
+		}
+	#endif
+	
 	func testCombine2() {
 		var results = [Result<String, SignalEnd>]()
 		
@@ -1951,6 +2276,57 @@ class SignalTests: XCTestCase {
 		XCTAssert(results.at(0)?.error?.isComplete == true)
 	}
 	
+	func testAsyncBatchDelivery() {
+		// Results queued behind a slow asynchronous handler are delivered in order
+		let sem = DispatchSemaphore(value: 0)
+		let ex = expectation(description: "Waiting for all results")
+		var results = Array<Int>()
+		let (input, signal) = Signal<Int>.create()
+		let ep = signal.subscribe(context: .global) { r in
+			switch r {
+			case .success(let v):
+				if v == 0 {
+					sem.wait()
+				}
+				results.append(v)
+			case .failure: ex.fulfill()
+			}
+		}
+		input.send(sequence: 0..<200)
+		input.complete()
+		sem.signal()
+		waitForExpectations(timeout: 1e1, handler: nil)
+		XCTAssert(results == Array(0..<200))
+		withExtendedLifetime(ep) {}
+		
+		// Cancelling from inside the handler stops delivery of the rest of the batch
+		let sem2 = DispatchSemaphore(value: 0)
+		let ex2 = expectation(description: "Waiting for cancel")
+		var results2 = Array<Int>()
+		let (input2, signal2) = Signal<Int>.create()
+		var ep2: SignalOutput<Int>? = nil
+		ep2 = signal2.subscribe(context: .global) { r in
+			if let v = r.value {
+				if v == 0 {
+					sem2.wait()
+				}
+				results2.append(v)
+				if v == 5 {
+					ep2?.cancel()
+					ex2.fulfill()
+				}
+			}
+		}
+		input2.send(sequence: 0..<100)
+		sem2.signal()
+		waitForExpectations(timeout: 1e1, handler: nil)
+		
+		// Allow time for any erroneous deliveries
+		Thread.sleep(forTimeInterval: 0.05)
+		XCTAssert(results2 == Array(0...5))
+		ep2 = nil
+	}
+	
 	func testSyncMutexAssurances() {
 		let (context, specificKey) = Exec.syncQueueWithSpecificKey()
 		var result = [Int]()
@@ -2117,6 +2493,49 @@ class SignalTimingTests: XCTestCase {
 			print("Baseline is is \(elapsed2) seconds (\(elapsed / elapsed2) times faster).")
 		}
 		
+		func testBatchPerformance() {
+			var sequenceLength = 10_000_000
+			var expected = 1.5
+			var upperThreshold = 5.0
+			let batchSize = 1_000
+			
+			// Override the test parameters when running in Debug.
+			#if DEBUG
+				sequenceLength = 10_000
+				expected = 0.01
+				upperThreshold = 0.5
+			#endif
+			
+			let t = mach_absolute_time()
+			var count = 0
+			
+			// The same as `testSinglePerformance` but sending in batches so the `Signal` mutex is taken once per batch, rather than once per value.
+			_ = Signal<Int>.generate(context: .direct) { input in
+				guard let i = input else { return }
+				var batch = Array<Result<Int, SignalEnd>>()
+				batch.reserveCapacity(batchSize)
+				for v in 0..<sequenceLength {
+					batch.append(.success(v))
+					if batch.count == batchSize {
+						if let _ = i.send(contentsOf: batch) { break }
+						batch.removeAll(keepingCapacity: true)
+					}
+				}
+				i.send(contentsOf: batch)
+				i.complete()
+			}.subscribe { r in
+				switch r {
+				case .success: count += 1
+				case .failure: break
+				}
+			}
+			
+			XCTAssert(count == sequenceLength)
+			let elapsed = 1e-9 * Double(mach_absolute_time() - t)
+			XCTAssert(elapsed < upperThreshold)
+			print("Performance is \(elapsed) seconds versus expected \(expected). Rate is \(Double(sequenceLength) / elapsed) per second.")
+		}
+		
 		func testSyncMapPerformance() {
 			var sequenceLength = 10_000_000
 			var expected = 10.0 // +/- 0.4